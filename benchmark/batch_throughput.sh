@@ -0,0 +1,67 @@
+#!/bin/bash
+
+# Batch throughput: compiles every program of the test corpus once with a
+# separate compiler process per file and once with a single --batch run, checks
+# that both produce the same .s, .out and .err files, and reports files/s.
+# Units that crash are reported as failed by the batch, which goes on.
+# Usage: ./batch_throughput.sh [rounds]   (default: 3)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+TEST_DIR="$BASE_DIR/test"
+OUTPUT_DIR="$BASE_DIR/benchmark/output/batch"
+
+ROUNDS="${1:-3}"
+
+rm -rf "$OUTPUT_DIR"
+mkdir -p "$OUTPUT_DIR/src" "$OUTPUT_DIR/separate" "$OUTPUT_DIR/batch"
+
+# Flatten the corpus so that every unit has its own output stem
+inputs=()
+for test_file in $(cd "$TEST_DIR" && find . -type f -name "*.c" | sort); do
+    input="$OUTPUT_DIR/src/$(echo "${test_file#./}" | tr / _)"
+    cp "$TEST_DIR/$test_file" "$input"
+    inputs+=("$input")
+done
+
+run_separate() {
+    for input in "${inputs[@]}"; do
+        stem="$OUTPUT_DIR/separate/$(basename "$input" .c)"
+        "$SRC" -o "$stem.s" "$input" > "$stem.out" 2> "$stem.err"
+        [[ -s "$stem.err" ]] || rm -f "$stem.err"
+    done
+}
+
+run_batch() {
+    "$SRC" --batch -o "$OUTPUT_DIR/batch" "${inputs[@]}" > "$OUTPUT_DIR/progress.txt"
+}
+
+# Sets elapsed to the mean wall time of ROUNDS runs of $1
+time_rounds() {
+    local start end
+    start=$(date +%s.%N)
+    for ((round = 0; round < ROUNDS; round++)); do
+        "$1" 2> /dev/null # The shell and the batch report crashed units on stderr
+    done
+    end=$(date +%s.%N)
+    elapsed=$(awk -v s="$start" -v e="$end" -v r="$ROUNDS" 'BEGIN { printf "%.3f", (e - s) / r }')
+}
+
+time_rounds run_separate
+separate_time=$elapsed
+time_rounds run_batch
+batch_time=$elapsed
+
+if ! diff -r "$OUTPUT_DIR/separate" "$OUTPUT_DIR/batch" > "$OUTPUT_DIR/diff.txt"; then
+    echo "❌ --batch output differs from separate runs, see $OUTPUT_DIR/diff.txt"
+    exit 1
+fi
+echo "✅ --batch output is identical to separate runs (${#inputs[@]} files, $(grep -c ": failed$" "$OUTPUT_DIR/progress.txt") failed)"
+
+printf "%-12s %-12s %-12s\n" "Mode" "Time (s)" "Files/s"
+awk -v n="${#inputs[@]}" -v s="$separate_time" -v b="$batch_time" 'BEGIN {
+    printf "%-12s %-12.3f %-12.1f\n", "separate", s, n / s
+    printf "%-12s %-12.3f %-12.1f\n", "batch", b, n / b
+    printf "Speedup: %.2fx\n", s / b
+}'
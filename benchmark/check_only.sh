@@ -0,0 +1,57 @@
+#!/bin/bash
+
+# Check only: runs the compiler over every program of the test corpus, once
+# as usual and once with --check-only, and reports the total and mean
+# latency of each. Checks that both write the same diagnostics on stderr
+# for every program whose normal run does not crash.
+# Usage: ./check_only.sh [rounds]   (default: 3)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+TEST_DIR="$BASE_DIR/test"
+OUTPUT_DIR="$BASE_DIR/benchmark/output/check_only"
+
+ROUNDS="${1:-3}"
+
+rm -rf "$OUTPUT_DIR"
+mkdir -p "$OUTPUT_DIR"
+
+mapfile -t inputs < <(find "$TEST_DIR" -name "*.c" | sort)
+
+# Prints the milliseconds taken to run the compiler with the given options on
+# every input, ROUNDS times
+time_runs() {
+    local start end
+    start=$(date +%s%N)
+    for ((round = 0; round < ROUNDS; round++)); do
+        for input in "${inputs[@]}"; do
+            "$SRC" "$@" "$input" > /dev/null 2>&1
+        done
+    done
+    end=$(date +%s%N)
+    echo $(((end - start) / 1000000))
+}
+
+full=$(time_runs --no-tac -o "$OUTPUT_DIR/program.s")
+check=$(time_runs --check-only)
+runs=$((${#inputs[@]} * ROUNDS))
+
+printf "%-16s %-12s %-14s\n" "Mode" "Total(ms)" "Mean(ms)"
+printf "%-16s %-12s %-14s\n" "full compile" "$full" "$(awk -v t="$full" -v n="$runs" 'BEGIN { printf "%.2f", t / n }')"
+printf "%-16s %-12s %-14s\n" "--check-only" "$check" "$(awk -v t="$check" -v n="$runs" 'BEGIN { printf "%.2f", t / n }')"
+awk -v a="$full" -v b="$check" 'BEGIN { if (b > 0) printf "Speedup: %.1fx\n", a / b }'
+
+status=0
+for input in "${inputs[@]}"; do
+    code=$( ("$SRC" --no-tac -o "$OUTPUT_DIR/program.s" "$input" > /dev/null 2> "$OUTPUT_DIR/full.err"; echo $?) 2> /dev/null )
+    (( code >= 128 )) && continue # Crashed, maybe before all of its diagnostics were written
+    "$SRC" --check-only "$input" > /dev/null 2> "$OUTPUT_DIR/check.err"
+    if ! cmp -s "$OUTPUT_DIR/full.err" "$OUTPUT_DIR/check.err"; then
+        echo "❌ diagnostics differ for ${input#$TEST_DIR/}"
+        status=1
+    fi
+done
+
+[[ $status -eq 0 ]] && echo "✅ --check-only reports the same diagnostics (${#inputs[@]} programs)"
+exit $status
@@ -0,0 +1,38 @@
+#!/bin/bash
+
+# Compiles generated programs of increasing size and reports the time per
+# source line, so that super-linear behaviour in codegen shows up directly.
+# Usage: ./codegen_scaling.sh [functions...]   (default: 240 480 960 1920)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+BENCH_DIR="$BASE_DIR/benchmark"
+OUTPUT_DIR="$BASE_DIR/benchmark/output"
+
+SIZES=("$@")
+if [[ ${#SIZES[@]} -eq 0 ]]; then
+    SIZES=(240 480 960 1920)
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+printf "%-12s %-10s %-12s %-12s\n" "Functions" "Lines" "Time (s)" "us/line"
+for funcs in "${SIZES[@]}"; do
+    input="$OUTPUT_DIR/gen_$funcs.c"
+    "$BENCH_DIR/gen_program.sh" "$funcs" 20 > "$input"
+    lines=$(wc -l < "$input")
+
+    start=$(date +%s.%N)
+    "$SRC" "$input" > "$OUTPUT_DIR/gen_$funcs.txt" 2>&1
+    exit_code=$?
+    end=$(date +%s.%N)
+
+    if [[ $exit_code -ne 0 ]]; then
+        echo "❌ Exit Code $exit_code for $input"
+        exit 1
+    fi
+
+    awk -v f="$funcs" -v l="$lines" -v s="$start" -v e="$end" \
+        'BEGIN { t = e - s; printf "%-12s %-10s %-12.3f %-12.1f\n", f, l, t, t * 1000000 / l }'
+done
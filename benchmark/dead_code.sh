@@ -0,0 +1,38 @@
+#!/bin/bash
+
+# Dead code: compiles generated programs of growing size with --dce, after
+# giving every function a local loop whose result nothing uses, and reports
+# the TAC instructions removed, the time of the pass from --time-report and
+# the lines of assembly with and without --dce.
+# Usage: ./dead_code.sh [functions...]   (default: 100 200 400)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+BENCH_DIR="$BASE_DIR/benchmark"
+OUTPUT_DIR="$BASE_DIR/benchmark/output/dead_code"
+
+SIZES=("$@")
+[[ ${#SIZES[@]} -eq 0 ]] && SIZES=(100 200 400)
+
+rm -rf "$OUTPUT_DIR"
+mkdir -p "$OUTPUT_DIR"
+
+printf "%-12s %-16s %-14s %-14s %-14s\n" "Functions" "TAC removed" "--dce (ms)" "Lines of .s" "With --dce"
+status=0
+for funcs in "${SIZES[@]}"; do
+    stem="$OUTPUT_DIR/program$funcs"
+    "$BENCH_DIR/gen_program.sh" -f "$funcs" -s 20 |
+        sed 's/^\(    int y = x \* 2;\)$/\1\n    int unused = 0;\n    while (unused < 100) { unused = unused + 1; }/' > "$stem.c"
+    if ! "$SRC" --no-tac -o "$stem.s" "$stem.c" > /dev/null 2>&1 ||
+       ! "$SRC" --no-tac --dce --dce-stats --time-report -o "$stem.dce.s" "$stem.c" > /dev/null 2> "$stem.report"; then
+        echo "❌ compilation failed for $funcs functions"
+        status=1
+        continue
+    fi
+    removed=$(awk '/^Dead code:/ { print $4 " of " $6 }' "$stem.report")
+    elapsed=$(awk '$1 == "dead-code" { print $3 }' "$stem.report")
+    printf "%-12s %-16s %-14s %-14s %-14s\n" "$funcs" "$removed" "$elapsed" "$(wc -l < "$stem.s")" "$(wc -l < "$stem.dce.s")"
+done
+
+exit $status
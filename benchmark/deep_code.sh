@@ -0,0 +1,68 @@
+#!/bin/bash
+
+# Stress test for instruction list building: compiles one long expression
+# (x + 1 + 2 + ... with N terms) and N nested while loops.
+# Usage: ./deep_code.sh [sizes...]   (default: 1000 2000 5000 terms; loops use size / 5)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+OUTPUT_DIR="$BASE_DIR/benchmark/output"
+
+SIZES=("$@")
+if [[ ${#SIZES[@]} -eq 0 ]]; then
+    SIZES=(1000 2000 5000)
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+run() {
+    local name=$1 size=$2 input=$3
+    start=$(date +%s.%N)
+    "$SRC" "$input" > "${input%.c}.txt" 2>&1
+    exit_code=$?
+    end=$(date +%s.%N)
+
+    if [[ $exit_code -ne 0 ]]; then
+        echo "❌ Exit Code $exit_code for $input"
+        exit 1
+    fi
+
+    awk -v n="$name" -v d="$size" -v s="$start" -v e="$end" 'BEGIN { printf "%-12s %-12s %-12.3f\n", n, d, e - s }'
+}
+
+printf "%-12s %-12s %-12s\n" "Case" "Size" "Time (s)"
+for size in "${SIZES[@]}"; do
+    input="$OUTPUT_DIR/expression_$size.c"
+    {
+        echo "int main()"
+        echo "{"
+        echo "    int x = 1;"
+        printf "    x = x"
+        for ((i = 1; i < size; i++)); do
+            printf " + %d" "$i"
+        done
+        echo ";"
+        echo "    return x;"
+        echo "}"
+    } > "$input"
+    run "expression" "$size" "$input"
+
+    loops=$((size / 5))
+    input="$OUTPUT_DIR/loops_$loops.c"
+    {
+        echo "int main()"
+        echo "{"
+        echo "    int x = 0;"
+        for ((i = 0; i < loops; i++)); do
+            echo "while (x < $i) {"
+        done
+        echo "    x = x + 1;"
+        for ((i = 0; i < loops; i++)); do
+            echo "}"
+        done
+        echo "    return x;"
+        echo "}"
+    } > "$input"
+    run "loops" "$loops" "$input"
+done
@@ -0,0 +1,109 @@
+#!/bin/bash
+
+# Generates a synthetic source file on stdout.
+# Usage: ./gen_program.sh <functions> <statements per function>
+#        ./gen_program.sh [-f functions] [-s statements] [-e expression depth]
+#                         [-n nesting depth] [-t structs/classes] [-g globals]
+#
+# -e is the depth of the parenthesised expression in every fourth statement,
+# -n how deeply the if/while nest in every fourth statement goes, -t how many
+# struct and class types are declared (used through a local struct or a
+# global object in each function) and -g how many globals are read.
+# Without options the output is the same as with only the two positional
+# arguments: 10 functions of 20 statements, expression depth 1, nesting
+# depth 1, no types and one global.
+
+FUNCS=10
+STMTS=20
+DEPTH=1
+NEST=1
+TYPES=0
+GLOBALS=1
+
+while getopts "f:s:e:n:t:g:" opt; do
+    case $opt in
+        f) FUNCS=$OPTARG ;;
+        s) STMTS=$OPTARG ;;
+        e) DEPTH=$OPTARG ;;
+        n) NEST=$OPTARG ;;
+        t) TYPES=$OPTARG ;;
+        g) GLOBALS=$OPTARG ;;
+        *) echo "Usage: $0 [-f functions] [-s statements] [-e depth] [-n nesting] [-t types] [-g globals]" >&2; exit 1 ;;
+    esac
+done
+shift $((OPTIND - 1))
+[[ -n $1 ]] && FUNCS=$1
+[[ -n $2 ]] && STMTS=$2
+[[ $GLOBALS -lt 1 ]] && GLOBALS=1
+
+awk -v funcs="$FUNCS" -v stmts="$STMTS" -v depth="$DEPTH" -v nest="$NEST" -v types="$TYPES" -v globals="$GLOBALS" '
+# x op (y op (... (s))) with d operators
+function expression(d, s,    e, i) {
+    e = s
+    for (i = d - 1; i > 0; i--) e = "(" (i % 2 ? "y" : "x") " " substr("+-*", i % 3 + 1, 1) " " e ")"
+    return "x + " e
+}
+# d nested ifs and whiles around one assignment
+function nested(d, s,    head, tail, i) {
+    head = ""; tail = ""
+    for (i = 0; i < d - 1; i++) {
+        head = head (i % 2 ? "while (x < " s ") { " : "if (x > y) { ")
+        tail = tail " }"
+    }
+    return head "x = x - " s ";" tail
+}
+BEGIN {
+    print "int g0 = 1;"
+    for (g = 1; g < globals; g++) print "int g" g " = " g ";"
+    for (t = 0; t < types; t++) {
+        if (t % 2 == 0) {
+            print "struct S" t " { int a; int b; };"
+        } else {
+            print "class C" t " {"
+            print "public:"
+            print "    int v;"
+            print "    int w;"
+            print "    int get(int a) { return a + 1; }"
+            print "};"
+            print "class C" t " c" t ";"
+        }
+    }
+    for (f = 0; f < funcs; f++) {
+        print "int f" f "(int a, int b)"
+        print "{"
+        print "    int x = a + b;"
+        print "    int y = x * 2;"
+        t = types > 0 ? f % types : -1
+        if (t >= 0 && t % 2 == 0) {
+            print "    struct S" t " s;"
+            print "    s.a = x;"
+            print "    s.b = y;"
+        }
+        for (s = 0; s < stmts; s++) {
+            k = s % 4
+            if (k == 0) {
+                if (depth > 1) print "    x = " expression(depth, s) ";"
+                else print "    x = x + y * " s ";"
+            } else if (k == 1) {
+                if (nest > 1) print "    " nested(nest, s)
+                else print "    if (x > y) { x = x - " s "; } else { y = y + " s "; }"
+            } else if (k == 2) {
+                print "    while (x < " s ") { x = x + 1; }"
+            } else {
+                print "    y = (x - y) + g" (s % globals) ";"
+            }
+        }
+        if (t >= 0 && t % 2 == 0) print "    x = x + s.a + s.b;"
+        if (t >= 0 && t % 2 == 1) {
+            print "    c" t ".v = x;"
+            print "    y = y + c" t ".w;"
+        }
+        print "    return x + y;"
+        print "}"
+    }
+    print "int main()"
+    print "{"
+    print "    int s = f0(1, 2);"
+    print "    return 0;"
+    print "}"
+}'
@@ -0,0 +1,59 @@
+#!/bin/bash
+
+# Incremental cache: compiles one large generated program with --cache-dir
+# three times, into an empty cache (cold), again unchanged (warm), and after
+# editing one function in the middle (edit), checks that every run produces
+# the same assembly and stdout as a compile without the cache, and reports the
+# hit rate and the lowering time saved of --cache-stats.
+# Usage: ./incremental_cache.sh [functions] [statements]   (default: 200 40)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+BENCH_DIR="$BASE_DIR/benchmark"
+OUTPUT_DIR="$BASE_DIR/benchmark/output/incremental_cache"
+
+FUNCTIONS="${1:-200}"
+STATEMENTS="${2:-40}"
+
+rm -rf "$OUTPUT_DIR"
+mkdir -p "$OUTPUT_DIR"
+input="$OUTPUT_DIR/program.c"
+edited="$OUTPUT_DIR/edited.c"
+"$BENCH_DIR/gen_program.sh" -f "$FUNCTIONS" -s "$STATEMENTS" -e 4 -n 3 > "$input"
+
+# The edit changes one constant of the function in the middle
+awk -v f="f$((FUNCTIONS / 2))" '
+    $2 ~ "^" f "\\(" { inside = 1 }
+    inside && sub(/x \* 2/, "x * 3") { inside = 0 }
+    { print }' "$input" > "$edited"
+
+printf "%-8s %-12s %-18s %-14s %-12s\n" "Run" "Hit rate" "Time saved (ms)" "Overhead (ms)" "Total (ms)"
+failed=0
+for run in cold warm edit; do
+    source_file=$input
+    [[ $run == edit ]] && source_file=$edited
+    out="$OUTPUT_DIR/$run"
+    "$SRC" --no-tac -o "$out.ref.s" "$source_file" > "$out.ref.out" 2> /dev/null
+    "$SRC" --cache-dir "$OUTPUT_DIR/cache" --cache-stats --time-report --no-tac -o "$out.s" "$source_file" > "$out.out" 2> "$out.report"
+    exit_code=$?
+    if [[ $exit_code -ne 0 ]]; then
+        echo "❌ Exit Code $exit_code on the $run run"
+        failed=1
+        continue
+    fi
+
+    awk -v run="$run" '
+        $1 == "Function" && $2 == "cache:" { rate = $7; sub(/^\(/, "", rate) }
+        $1 == "Lowering" && $3 == "saved:" { saved = $4; overhead = $11 }
+        $1 == "Total" { total = $2 }
+        END { printf "%-8s %-12s %-18s %-14s %-12s\n", run, rate, saved, overhead, total }' "$out.report"
+
+    if ! cmp -s "$out.s" "$out.ref.s" || ! cmp -s "$out.out" "$out.ref.out"; then
+        echo "❌ The $run run differs from a compile without the cache"
+        failed=1
+    fi
+done
+
+[[ $failed -eq 0 ]] && echo "✅ Output is the same with and without the cache ($FUNCTIONS functions)"
+exit $failed
@@ -0,0 +1,53 @@
+#!/bin/bash
+
+# Lexing throughput: tokenises a large generated file with --lex-only, once
+# scanning it in place from a memory mapping (the default) and once reading
+# it through a stdio stream (--no-mmap), and reports MB/s for both.
+# The file repeats one gen_program.sh chunk; redefinitions do not matter
+# because nothing past the lexer runs.
+# Usage: ./lexer_throughput.sh [sizes...]   (default: 8 32 128 MB)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+OUTPUT_DIR="$BASE_DIR/benchmark/output"
+
+SIZES=("$@")
+if [[ ${#SIZES[@]} -eq 0 ]]; then
+    SIZES=(8 32 128)
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+chunk="$OUTPUT_DIR/lexer_chunk.c"
+"$BASE_DIR/benchmark/gen_program.sh" 200 100 > "$chunk"
+chunk_bytes=$(wc -c < "$chunk")
+
+run() {
+    local mode=$1 input=$2 bytes=$3
+    shift 3
+    start=$(date +%s.%N)
+    "$SRC" --lex-only "$@" "$input" > /dev/null 2>&1
+    exit_code=$?
+    end=$(date +%s.%N)
+
+    if [[ $exit_code -ne 0 ]]; then
+        echo "❌ Exit Code $exit_code for $input ($mode)"
+        exit 1
+    fi
+
+    awk -v m="$mode" -v b="$bytes" -v s="$start" -v e="$end" 'BEGIN { printf "%-12s %-12.1f %-12.3f %-12.1f\n", m, b / 1048576, e - s, b / 1048576 / (e - s) }'
+}
+
+printf "%-12s %-12s %-12s %-12s\n" "Input" "Size (MB)" "Time (s)" "MB/s"
+for size in "${SIZES[@]}"; do
+    input="$OUTPUT_DIR/lexer_$size.c"
+    : > "$input"
+    for ((i = 0; i < size * 1048576 / chunk_bytes + 1; i++)); do
+        cat "$chunk" >> "$input"
+    done
+    bytes=$(wc -c < "$input")
+
+    run "stream" "$input" "$bytes" --no-mmap
+    run "mmap" "$input" "$bytes"
+done
@@ -0,0 +1,47 @@
+#!/bin/bash
+
+# Stress test for block scopes: compiles a main() with N nested blocks, each
+# declaring one local variable.
+# Usage: ./nested_blocks.sh [depths...]   (default: 1000 2000 5000 10000)
+
+BASE_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && cd .. && pwd)"
+
+SRC="${COMPILER:-$BASE_DIR/src/build/bin/compiler}"
+OUTPUT_DIR="$BASE_DIR/benchmark/output"
+
+DEPTHS=("$@")
+if [[ ${#DEPTHS[@]} -eq 0 ]]; then
+    DEPTHS=(1000 2000 5000 10000)
+fi
+
+mkdir -p "$OUTPUT_DIR"
+
+printf "%-12s %-12s\n" "Depth" "Time (s)"
+for depth in "${DEPTHS[@]}"; do
+    input="$OUTPUT_DIR/nested_$depth.c"
+    {
+        echo "int main()"
+        echo "{"
+        echo "    int x = 0;"
+        for ((i = 0; i < depth; i++)); do
+            echo "{ int v$i = x; x = v$i + 1;"
+        done
+        for ((i = 0; i < depth; i++)); do
+            echo "}"
+        done
+        echo "    return x;"
+        echo "}"
+    } > "$input"
+
+    start=$(date +%s.%N)
+    "$SRC" "$input" > "$OUTPUT_DIR/nested_$depth.txt" 2>&1
+    exit_code=$?
+    end=$(date +%s.%N)
+
+    if [[ $exit_code -ne 0 ]]; then
+        echo "❌ Exit Code $exit_code for $input"
+        exit 1
+    fi
+
+    awk -v d="$depth" -v s="$start" -v e="$end" 'BEGIN { printf "%-12s %-12.3f\n", d, e - s }'
+done
@@ -0,0 +1,81 @@
+.data
+immediate_0: .word 1
+immediate_1: .word 5
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_factorial_S0__sig_5:
+ADDIU $sp, $sp, -40
+SW $ra, 36($sp)
+SW $fp, 32($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 40($fp)
+BLE $t2, $t1, L1
+NOP
+SW $t1, 28($fp)
+J L2
+NOP
+L1:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+MOVE $v0, $t1
+SW $t1, 20($fp)
+J L3
+NOP
+L2:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 40($fp)
+SUBU $t3, $t2, $t1
+ADDIU $sp, $sp, -4
+SW $t3, 0($sp)
+SW $t1, 16($fp)
+SW $t2, 40($fp)
+SW $t3, 12($fp)
+LI $a0, 8
+JAL _f_factorial_S0__sig_5
+NOP
+ADDIU $sp, $sp, 4
+LW $t1, 16($fp)
+LW $t2, 40($fp)
+LW $t3, 12($fp)
+MOVE $t0, $v0
+MUL $t4, $t2, $t0
+MOVE $v0, $t4
+SW $t0, 4($fp)
+SW $t2, 40($fp)
+SW $t4, 0($fp)
+J L3
+NOP
+L3:
+LW $fp, 32($sp)
+LW $ra, 36($sp)
+ADDIU $sp, $sp, 40
+JR $ra
+_f_main_S0__sig:
+ADDIU $sp, $sp, -24
+SW $ra, 20($sp)
+SW $fp, 16($sp)
+MOVE $fp, $sp
+LA $t0, immediate_1
+LW $t1, 0($t0)
+ADDIU $sp, $sp, -4
+SW $t1, 0($sp)
+SW $t1, 12($fp)
+LI $a0, 8
+JAL _f_factorial_S0__sig_5
+NOP
+ADDIU $sp, $sp, 4
+LW $t1, 12($fp)
+MOVE $t0, $v0
+LW $fp, 16($sp)
+LW $ra, 20($sp)
+ADDIU $sp, $sp, 24
+JR $ra
+
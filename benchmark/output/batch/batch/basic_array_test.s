@@ -0,0 +1,49 @@
+.data
+immediate_0: .word 2
+immediate_1: .word 20
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -220836
+SW $ra, 220832($sp)
+SW $fp, 220828($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LI $t2, 2400
+MUL $t3, $t1, $t2
+LA $t4, 196816($fp)
+ADDU $t5, $t4, $t3
+LW $t6, 0($t5)
+LA $t0, immediate_1
+LW $t7, 0($t0)
+SLL $t8, $t7, 0
+SRA $t8, $t8, 0
+SW $t8, 0($t5)
+LA $t0, immediate_0
+LW $t6, 0($t0)
+LI $t2, 2400
+MUL $t9, $t6, $t2
+ADDU $t0, $t4, $t9
+SW $t1, 196812($fp)
+LW $t1, 0($t0)
+SW $t1, 0($t0)
+LW $t1, 0($t1)
+SW $t1, 0($t2)
+LW $t2, 0($t1)
+LA $t1, immediate_1
+LW $t1, 0($t1)
+SW $t3, 194412($fp)
+SLL $t3, $t1, 0
+SRA $t3, $t3, 0
+SW $t3, 0($t2)
+LW $fp, 220828($sp)
+LW $ra, 220832($sp)
+ADDIU $sp, $sp, 220836
+JR $ra
+
@@ -0,0 +1,27 @@
+.data
+immediate_0: .byte 97
+immediate_1: .byte 95
+immediate_2: .byte 13
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -14
+SW $ra, 10($sp)
+SW $fp, 6($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LB $t1, 0($t0)
+LA $t0, immediate_1
+LB $t2, 0($t0)
+LA $t0, immediate_2
+LB $t3, 0($t0)
+LW $fp, 6($sp)
+LW $ra, 10($sp)
+ADDIU $sp, $sp, 14
+JR $ra
+
@@ -0,0 +1,57 @@
+.data
+immediate_0: .word 5
+immediate_1: .byte 53
+immediate_2: .word 0
+immediate_3: .byte 48
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -48
+SW $ra, 44($sp)
+SW $fp, 40($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LA $t0, immediate_1
+LB $t2, 0($t0)
+SW $t1, 36($fp)
+SW $t1, 32($fp)
+SB $t2, 31($fp)
+SB $t2, 30($fp)
+L1:
+LW $t0, 32($fp)
+LW $t1, 32($fp)
+ADDIU $t1, $t1, -1
+LA $t2, immediate_2
+LW $t3, 0($t2)
+BGT $t1, $t3, L1
+NOP
+SW $t0, 22($fp)
+SW $t1, 32($fp)
+SW $t3, 18($fp)
+J L2
+NOP
+L2:
+LB $t0, 30($fp)
+LB $t1, 30($fp)
+ADDIU $t1, $t1, -1
+LA $t2, immediate_3
+LB $t3, 0($t2)
+BGT $t1, $t3, L2
+NOP
+SB $t0, 5($fp)
+SB $t1, 30($fp)
+SB $t3, 4($fp)
+J L3
+NOP
+L3:
+LW $fp, 40($sp)
+LW $ra, 44($sp)
+ADDIU $sp, $sp, 48
+JR $ra
+
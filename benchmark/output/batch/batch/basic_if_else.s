@@ -0,0 +1,82 @@
+.data
+immediate_0: .word 5
+immediate_1: .word 0
+immediate_2: .word 2
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -60
+SW $ra, 56($sp)
+SW $fp, 52($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LA $t0, immediate_1
+LW $t2, 0($t0)
+BGT $t1, $t2, L1
+NOP
+SW $t1, 48($fp)
+SW $t1, 40($fp)
+SW $t2, 44($fp)
+SW $t2, 36($fp)
+J L2
+NOP
+L1:
+LW $t0, 40($fp)
+LW $t1, 36($fp)
+SUBU $t2, $t0, $t1
+SW $t2, 28($fp)
+SW $t2, 40($fp)
+J L3
+NOP
+L2:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 40($fp)
+BEQ $t2, $t1, L4
+NOP
+SW $t1, 24($fp)
+J L5
+NOP
+L4:
+LW $t0, 40($fp)
+LW $t1, 36($fp)
+BGT $t0, $t1, L6
+NOP
+J L7
+NOP
+L6:
+LW $t0, 40($fp)
+LW $t1, 36($fp)
+SUBU $t2, $t0, $t1
+SW $t2, 12($fp)
+SW $t2, 40($fp)
+J L8
+NOP
+L7:
+LW $t0, 40($fp)
+LW $t1, 36($fp)
+ADDU $t2, $t0, $t1
+SW $t2, 8($fp)
+SW $t2, 40($fp)
+L8:
+J L3
+NOP
+L5:
+LW $t0, 36($fp)
+LW $t1, 4($fp)
+SUBU $t2, $t0, $t1
+SW $t1, 4($fp)
+SW $t2, 0($fp)
+SW $t2, 36($fp)
+L3:
+LW $fp, 52($sp)
+LW $ra, 56($sp)
+ADDIU $sp, $sp, 60
+JR $ra
+
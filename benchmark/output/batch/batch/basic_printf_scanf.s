@@ -0,0 +1,290 @@
+.data
+immediate_0: .asciiz "%d"
+immediate_1: .asciiz "%f"
+immediate_2: .asciiz " %c"
+immediate_3: .asciiz "You entered: %c\n"
+immediate_4: .asciiz "Will this work ?? %f\n"
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -93
+SW $ra, 89($sp)
+SW $fp, 85($sp)
+MOVE $fp, $sp
+LA $t0, 81($fp)
+LA $t1, immediate_0
+ADDIU $sp, $sp, -4
+SW $t1, 0($sp)
+ADDIU $sp, $sp, -4
+SW $t0, 0($sp)
+SW $t0, 68($fp)
+SW $t1, 72($fp)
+LI $a0, 12
+JAL _f_scanf_S0__sig_1
+NOP
+ADDIU $sp, $sp, 8
+MOVE $t2, $v0
+LA $t3, 77($fp)
+LA $t4, immediate_1
+ADDIU $sp, $sp, -4
+SW $t4, 0($sp)
+ADDIU $sp, $sp, -4
+SW $t3, 0($sp)
+SW $t0, 68($fp)
+SW $t1, 72($fp)
+SW $t2, 60($fp)
+SW $t3, 52($fp)
+SW $t4, 56($fp)
+LI $a0, 12
+JAL _f_scanf_S0__sig_1
+NOP
+ADDIU $sp, $sp, 8
+LW $t2, 60($fp)
+MOVE $t5, $v0
+LA $t6, 76($fp)
+LA $t7, immediate_2
+ADDIU $sp, $sp, -4
+SW $t7, 0($sp)
+ADDIU $sp, $sp, -4
+SW $t6, 0($sp)
+SW $t0, 68($fp)
+SW $t1, 72($fp)
+SW $t2, 60($fp)
+SW $t3, 52($fp)
+SW $t4, 56($fp)
+SW $t5, 44($fp)
+SW $t6, 36($fp)
+SW $t7, 40($fp)
+LI $a0, 12
+JAL _f_scanf_S0__sig_1
+NOP
+ADDIU $sp, $sp, 8
+LW $t2, 60($fp)
+LW $t5, 44($fp)
+MOVE $t8, $v0
+LA $t9, immediate_3
+ADDIU $sp, $sp, -4
+SW $t9, 0($sp)
+LB $t0, 76($fp)
+ADDIU $sp, $sp, -1
+SB $t0, 0($sp)
+SB $t0, 76($fp)
+SW $t1, 72($fp)
+SW $t2, 60($fp)
+SW $t3, 52($fp)
+SW $t4, 56($fp)
+SW $t5, 44($fp)
+SW $t6, 36($fp)
+SW $t7, 40($fp)
+SW $t8, 28($fp)
+SW $t9, 24($fp)
+LI $a0, 9
+JAL _f_printf_S0__sig_1
+NOP
+ADDIU $sp, $sp, 5
+LB $t0, 76($fp)
+LW $t2, 60($fp)
+LW $t5, 44($fp)
+LW $t8, 28($fp)
+MOVE $t0, $v0
+LA $t1, 76($fp)
+LA $t2, immediate_4
+ADDIU $sp, $sp, -4
+SW $t2, 0($sp)
+ADDIU $sp, $sp, -4
+SW $t1, 0($sp)
+SW $t0, 16($fp)
+SW $t1, 8($fp)
+SW $t2, 12($fp)
+SW $t3, 52($fp)
+SW $t4, 56($fp)
+SW $t5, 44($fp)
+SW $t6, 36($fp)
+SW $t7, 40($fp)
+SW $t8, 28($fp)
+SW $t9, 24($fp)
+LI $a0, 12
+JAL _f_printf_S0__sig_1
+NOP
+ADDIU $sp, $sp, 8
+LW $t0, 16($fp)
+LW $t5, 44($fp)
+LW $t8, 28($fp)
+MOVE $t0, $v0
+LW $fp, 85($sp)
+LW $ra, 89($sp)
+ADDIU $sp, $sp, 93
+JR $ra
+
+_f_printf_S0__sig_1:
+    ADDIU $sp, $sp, -8
+    SW $ra, 4($sp)
+    SW $fp, 0($sp)
+    MOVE $fp, $sp
+
+	addu $a0, $a0, $sp
+
+    lw $t0, 0($a0)
+	addiu $a0, $a0, -4
+    move $t2, $a0
+
+next_char_printf:
+    lb $t3, 0($t0)
+    beqz $t3, done_printf
+
+    li $t4, '%'
+    beq $t3, $t4, handle_format_printf
+
+    li $v0, 11
+    move $a0, $t3
+    syscall
+
+    addiu $t0, $t0, 1
+    j next_char_printf
+
+handle_format_printf:
+    addiu $t0, $t0, 1
+    lb $t3, 0($t0)
+
+    beq $t3, 'd', print_int_printf
+    beq $t3, 's', print_string_printf
+    beq $t3, 'c', print_char_printf
+	beq $t3, 'f', print_float_printf
+
+    li $v0, 11
+    li $a0, '%'
+    syscall
+    move $a0, $t3
+    syscall
+
+    addiu $t0, $t0, 1
+    j next_char_printf
+
+print_int_printf:
+    lw $a0, 0($t2)
+    li $v0, 1
+    syscall
+
+    addiu $t2, $t2, -4    # move to next argument (backward)
+    addiu $t0, $t0, 1
+    j next_char_printf
+
+print_string_printf:
+    lw $a0, 0($t2)
+    li $v0, 4
+    syscall
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_printf
+
+print_char_printf:
+    lb $a0, 0($t2)
+    li $v0, 11
+    syscall
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_printf
+	
+print_float_printf:
+    lw $t1, 0($t2)         # Load float bits into $t1
+    mtc1 $t1, $f12         # Move bits into floating-point register $f12
+    li $v0, 2              # syscall 2: print float
+    syscall
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_printf
+
+done_printf:
+	LW $fp, 0($sp)
+    LW $ra, 4($sp)
+    ADDIU $sp, $sp, 8
+    JR $ra
+    jr $ra
+
+
+_f_scanf_S0__sig_1:
+    ADDIU $sp, $sp, -8
+    SW $ra, 4($sp)
+    SW $fp, 0($sp)
+    MOVE $fp, $sp
+
+    addu $a0, $a0, $sp   # Adjust $a0 if needed
+
+    lw $t0, 0($a0)       # Load format string address
+    addiu $a0, $a0, -4   # $t2 will point to addresses where inputs are to be stored
+    move $t2, $a0
+
+next_char_scanf:
+    lb $t3, 0($t0)       # Load current char
+    beqz $t3, done_scanf
+
+    li $t4, '%'
+    bne $t3, $t4, skip_nonformat_scanf
+
+    addiu $t0, $t0, 1
+    lb $t3, 0($t0)
+
+    beq $t3, 'd', read_int_scanf
+    beq $t3, 's', read_string_scanf
+    beq $t3, 'c', read_char_scanf
+    beq $t3, 'f', read_float_scanf
+
+skip_nonformat_scanf:
+    addiu $t0, $t0, 1
+    j next_char_scanf
+
+read_int_scanf:
+    li $v0, 5          # syscall 5: read int
+    syscall
+    lw $t1, 0($t2)     # Load address where to store int
+    sw $v0, 0($t1)     # Store input value
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_scanf
+
+read_string_scanf:
+    li $v0, 8          # syscall 8: read string
+    lw $a0, 0($t2)     # Load address where to store string
+    li $a1, 100        # Max length of input (adjust if needed)
+    syscall
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_scanf
+
+read_char_scanf:
+    li $v0, 12         # syscall 12: read char
+    syscall
+    lw $t1, 0($t2)     # Load address where to store char
+    sb $v0, 0($t1)     # Store input byte
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_scanf
+
+read_float_scanf:
+    li $v0, 6          # syscall 6: read float
+    syscall
+    lw $t1, 0($t2)     # Load address where to store float
+    swc1 $f0, 0($t1)   # Store float into memory
+
+    addiu $t2, $t2, -4
+    addiu $t0, $t0, 1
+    j next_char_scanf
+
+done_scanf:
+    LW $fp, 0($sp)
+    LW $ra, 4($sp)
+    ADDIU $sp, $sp, 8
+    JR $ra
+
+
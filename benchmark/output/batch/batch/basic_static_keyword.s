@@ -0,0 +1,87 @@
+.data
+_v_global_counter_S0: .word 100
+immediate_0: .word 1
+_v_count_S1__in_28_f_test_static_local_S1__sig: .space 4
+t5: .word _v_count_S1__in_28_f_test_static_local_S1__sig
+_v_OK_S0: .space 4
+_v_FAIL_S0: .word 1
+_v_current_status_S0: .space 4
+_dt_static_union_instance_S0: .space 4
+_v_shared_S1__in_27_f_set_static_var_S1__sig_5: .space 4
+_v_shared_S1__in_25_f_get_static_var_S1__sig: .word -1
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+L1:
+_f_static_add_S0__sig_5:
+ADDIU $sp, $sp, -16
+SW $ra, 12($sp)
+SW $fp, 8($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 16($fp)
+ADDU $t3, $t2, $t1
+MOVE $v0, $t3
+SW $t1, 4($fp)
+SW $t3, 0($fp)
+J L2
+NOP
+L2:
+LW $fp, 8($sp)
+LW $ra, 12($sp)
+ADDIU $sp, $sp, 16
+JR $ra
+_f_test_static_local_S0__sig:
+ADDIU $sp, $sp, -20
+SW $ra, 16($sp)
+SW $fp, 12($sp)
+MOVE $fp, $sp
+LA $t0, _v_count_S1__in_28_f_test_static_local_S1__sig
+LW $t1, 0($t0)
+ADDIU $t1, $t1, 1
+LA $t2, _v_count_S1__in_28_f_test_static_local_S1__sig
+SW $t1, 0($t2)
+LW $fp, 12($sp)
+LW $ra, 16($sp)
+ADDIU $sp, $sp, 20
+JR $ra
+_f_set_static_var_S0__sig_5:
+ADDIU $sp, $sp, -16
+SW $ra, 12($sp)
+SW $fp, 8($sp)
+MOVE $fp, $sp
+LW $t0, 16($fp)
+LA $t1, _v_shared_S1__in_27_f_set_static_var_S1__sig_5
+SW $t0, 0($t1)
+LW $fp, 8($sp)
+LW $ra, 12($sp)
+ADDIU $sp, $sp, 16
+JR $ra
+_f_get_static_var_S0__sig:
+ADDIU $sp, $sp, -20
+SW $ra, 16($sp)
+SW $fp, 12($sp)
+MOVE $fp, $sp
+LW $fp, 12($sp)
+LW $ra, 16($sp)
+ADDIU $sp, $sp, 20
+JR $ra
+_f_main_S0__sig:
+ADDIU $sp, $sp, -8
+SW $ra, 4($sp)
+SW $fp, 0($sp)
+MOVE $fp, $sp
+LI $a0, 4
+JAL _f_get_static_var_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LW $fp, 0($sp)
+LW $ra, 4($sp)
+ADDIU $sp, $sp, 8
+JR $ra
+
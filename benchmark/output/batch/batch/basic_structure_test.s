@@ -0,0 +1,45 @@
+.data
+immediate_0: .word 10
+immediate_1: .word 20
+immediate_2: .word 30
+immediate_3: .word 40
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -80
+SW $ra, 76($sp)
+SW $fp, 72($sp)
+MOVE $fp, $sp
+LA $t0, 64($fp)
+ADDIU $t1, $t0, 0
+LW $t2, 0($t1)
+LA $t3, immediate_0
+LW $t4, 0($t3)
+SW $t4, 0($t1)
+LA $t2, 64($fp)
+ADDIU $t5, $t2, 4
+LW $t6, 0($t5)
+LA $t3, immediate_1
+LW $t7, 0($t3)
+SW $t7, 0($t5)
+LA $t6, 64($fp)
+ADDIU $t8, $t6, 0
+LW $t9, 0($t8)
+LA $t3, immediate_2
+LW $t0, 0($t3)
+SW $t0, 0($t8)
+ADDIU $t9, $t6, 4
+LW $t1, 0($t9)
+LA $t3, immediate_3
+LW $t2, 0($t3)
+SW $t2, 0($t9)
+LW $fp, 72($sp)
+LW $ra, 76($sp)
+ADDIU $sp, $sp, 80
+JR $ra
+
@@ -0,0 +1,244 @@
+.data
+immediate_0: .word 10000000000000
+immediate_1: .word 1000000000000000
+immediate_2: .word 42
+immediate_3: .word 1000
+immediate_4: .float 3.14
+immediate_5: .byte 65
+immediate_6: .word 65
+immediate_7: .word 300
+immediate_8: .word 4000000000
+immediate_9: .word 0
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_test_int_family_implicit_S0__sig:
+ADDIU $sp, $sp, -31
+SW $ra, 27($sp)
+SW $fp, 23($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+SLL $t2, $t1, 24
+SRA $t2, $t2, 24
+SLL $t3, $t2, 24
+SRA $t3, $t3, 24
+SLL $t4, $t3, 16
+SRA $t4, $t4, 16
+SLL $t5, $t4, 0
+SRA $t5, $t5, 0
+LW $fp, 23($sp)
+LW $ra, 27($sp)
+ADDIU $sp, $sp, 31
+JR $ra
+_f_test_int_family_explicit_S0__sig:
+ADDIU $sp, $sp, -46
+SW $ra, 42($sp)
+SW $fp, 38($sp)
+MOVE $fp, $sp
+LA $t0, immediate_1
+LW $t1, 0($t0)
+SLL $t2, $t1, 0
+SRA $t2, $t2, 0
+SLL $t3, $t2, 24
+SRA $t3, $t3, 24
+SLL $t4, $t2, 16
+SRA $t4, $t4, 16
+SLL $t5, $t2, 0
+SRA $t5, $t5, 0
+LW $fp, 38($sp)
+LW $ra, 42($sp)
+ADDIU $sp, $sp, 46
+JR $ra
+_f_test_int_to_float_implicit_S0__sig:
+ADDIU $sp, $sp, -44
+SW $ra, 40($sp)
+SW $fp, 36($sp)
+MOVE $fp, $sp
+LA $t0, immediate_2
+LW $t1, 0($t0)
+MTC1 $t1, $f2
+CVT.S.W $f2, $f2
+MTC1 $t1, $f4
+CVT.D.W $f4, $f4
+LA $t0, immediate_3
+LW $t2, 0($t0)
+SLL $t3, $t2, 0
+SRA $t3, $t3, 0
+MTC1 $t3, $f6
+CVT.D.W $f6, $f6
+LW $fp, 36($sp)
+LW $ra, 40($sp)
+ADDIU $sp, $sp, 44
+JR $ra
+_f_test_int_to_float_explicit_S0__sig:
+ADDIU $sp, $sp, -64
+SW $ra, 60($sp)
+SW $fp, 56($sp)
+MOVE $fp, $sp
+LA $t0, immediate_2
+LW $t1, 0($t0)
+MTC1 $t1, $f2
+CVT.S.W $f2, $f2
+MTC1 $t1, $f4
+CVT.D.W $f4, $f4
+LA $t0, immediate_3
+LW $t2, 0($t0)
+SLL $t3, $t2, 0
+SRA $t3, $t3, 0
+MTC1 $t3, $f6
+CVT.D.W $f6, $f6
+LW $fp, 56($sp)
+LW $ra, 60($sp)
+ADDIU $sp, $sp, 64
+JR $ra
+_f_test_float_to_int_implicit_S0__sig:
+ADDIU $sp, $sp, -40
+SW $ra, 36($sp)
+SW $fp, 32($sp)
+MOVE $fp, $sp
+LA $t0, immediate_4
+LWC1 $f2, 0($t0)
+CVT.W.S $f2, $f2
+MFC1 $t1, $f2
+CVT.W.S $f2, $f2
+MFC1 $t2, $f2
+LA $t0, immediate_4
+LWC1 $f4, 0($t0)
+CVT.D.S $f6, $f4
+LW $fp, 32($sp)
+LW $ra, 36($sp)
+ADDIU $sp, $sp, 40
+JR $ra
+_f_test_float_to_int_explicit_S0__sig:
+ADDIU $sp, $sp, -52
+SW $ra, 48($sp)
+SW $fp, 44($sp)
+MOVE $fp, $sp
+LA $t0, immediate_4
+LWC1 $f2, 0($t0)
+CVT.W.S $f2, $f2
+MFC1 $t1, $f2
+CVT.W.S $f2, $f2
+MFC1 $t2, $f2
+LA $t0, immediate_4
+LWC1 $f4, 0($t0)
+CVT.D.S $f6, $f4
+LW $t3, 4($fp)
+LW $fp, 44($sp)
+LW $ra, 48($sp)
+ADDIU $sp, $sp, 52
+JR $ra
+_f_test_char_to_int_implicit_S0__sig:
+ADDIU $sp, $sp, -16
+SW $ra, 12($sp)
+SW $fp, 8($sp)
+MOVE $fp, $sp
+LA $t0, immediate_5
+LB $t1, 0($t0)
+SLL $t2, $t1, 24
+SRA $t2, $t2, 24
+SLL $t3, $t1, 24
+SRA $t3, $t3, 24
+LW $fp, 8($sp)
+LW $ra, 12($sp)
+ADDIU $sp, $sp, 16
+JR $ra
+_f_test_int_to_char_implicit_S0__sig:
+ADDIU $sp, $sp, -17
+SW $ra, 13($sp)
+SW $fp, 9($sp)
+MOVE $fp, $sp
+LA $t0, immediate_6
+LW $t1, 0($t0)
+SLL $t2, $t1, 24
+SRA $t2, $t2, 24
+LW $fp, 9($sp)
+LW $ra, 13($sp)
+ADDIU $sp, $sp, 17
+JR $ra
+_f_test_int_to_char_explicit_S0__sig:
+ADDIU $sp, $sp, -18
+SW $ra, 14($sp)
+SW $fp, 10($sp)
+MOVE $fp, $sp
+LA $t0, immediate_7
+LW $t1, 0($t0)
+SLL $t2, $t1, 24
+SRA $t2, $t2, 24
+LW $fp, 10($sp)
+LW $ra, 14($sp)
+ADDIU $sp, $sp, 18
+JR $ra
+_f_test_unsigned_signed_S0__sig:
+ADDIU $sp, $sp, -24
+SW $ra, 20($sp)
+SW $fp, 16($sp)
+MOVE $fp, $sp
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $fp, 16($sp)
+LW $ra, 20($sp)
+ADDIU $sp, $sp, 24
+JR $ra
+_f_main_S0__sig:
+ADDIU $sp, $sp, -12
+SW $ra, 8($sp)
+SW $fp, 4($sp)
+MOVE $fp, $sp
+LI $a0, 4
+JAL _f_test_int_family_implicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_int_family_explicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_int_to_float_implicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_int_to_float_explicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_float_to_int_implicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_float_to_int_explicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_char_to_int_implicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_int_to_char_implicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_int_to_char_explicit_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LI $a0, 4
+JAL _f_test_unsigned_signed_S0__sig
+NOP
+ADDIU $sp, $sp, 0
+LA $t0, immediate_9
+LW $t1, 0($t0)
+MOVE $v0, $t1
+SW $t1, 0($fp)
+J L1
+NOP
+L1:
+LW $fp, 4($sp)
+LW $ra, 8($sp)
+ADDIU $sp, $sp, 12
+JR $ra
+
@@ -0,0 +1,18 @@
+.data
+immediate_0: .asciiz "hello"
+_f_foo_S0__sig:
+ADDIU $sp, $sp, -12
+SW $ra, 8($sp)
+SW $fp, 4($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+MOVE $v0, $t0
+SW $t0, 0($fp)
+J L1
+NOP
+L1:
+LW $fp, 4($sp)
+LW $ra, 8($sp)
+ADDIU $sp, $sp, 12
+JR $ra
+
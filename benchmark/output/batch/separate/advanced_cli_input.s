@@ -0,0 +1,81 @@
+.data
+immediate_0: .word 1
+immediate_1: .word 0
+immediate_2: .byte 0
+.text
+.global _start
+_start:
+jal _f_main_S0__sig_5_1
+li $v0, 10
+syscall
+
+_f_main_S0__sig_5_1:
+ADDIU $sp, $sp, -62
+SW $ra, 58($sp)
+SW $fp, 54($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 66($fp)
+BLT $t1, $t2, L1
+NOP
+SW $t1, 50($fp)
+SW $t1, 46($fp)
+J L2
+NOP
+L1:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+SW $t1, 34($fp)
+SW $t1, 30($fp)
+L5:
+LI $t0, 4
+MUL $t1, $t0, $t0
+LA $t2, 62($fp)
+ADDU $t3, $t2, $t1
+LI $t4, 1
+MUL $t5, $t4, $t4
+ADDU $t6, $t3, $t5
+LB $t7, 0($t6)
+LA $t8, immediate_2
+LB $t9, 0($t8)
+SB $t7, 0($t6)
+BNE $t7, $t9, L3
+NOP
+SW $t1, 26($fp)
+SW $t3, 22($fp)
+SW $t5, 18($fp)
+SW $t6, 14($fp)
+SB $t9, 12($fp)
+J L3
+NOP
+L4:
+LW $t0, 30($fp)
+LW $t1, 30($fp)
+ADDIU $t1, $t1, 1
+SW $t0, 4($fp)
+SW $t1, 30($fp)
+J L5
+NOP
+L3:
+LW $t0, 46($fp)
+SW $t0, 38($fp)
+L6:
+LW $t0, 46($fp)
+ADDIU $t0, $t0, 1
+SW $t0, 46($fp)
+J L6
+NOP
+L2:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+MOVE $v0, $t1
+SW $t1, 0($fp)
+J L7
+NOP
+L7:
+LW $fp, 54($sp)
+LW $ra, 58($sp)
+ADDIU $sp, $sp, 62
+JR $ra
+
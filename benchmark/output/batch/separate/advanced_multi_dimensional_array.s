@@ -0,0 +1,59 @@
+.data
+_v_matrix_S0: .space 36
+immediate_0: .word 9
+immediate_1: .word 0
+immediate_2: .word 1
+immediate_3: .word 2
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+L1:
+_f_main_S0__sig:
+ADDIU $sp, $sp, -188
+SW $ra, 184($sp)
+SW $fp, 180($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LA $t0, immediate_1
+LW $t2, 0($t0)
+LI $t3, 12
+MUL $t4, $t2, $t3
+LA $t5, _v_matrix_S0
+ADDU $t6, $t5, $t4
+LA $t0, immediate_1
+LW $t7, 0($t0)
+LI $t8, 4
+MUL $t9, $t7, $t8
+ADDU $t0, $t6, $t9
+SW $t1, 176($fp)
+SW $t1, 172($fp)
+LW $t1, 0($t0)
+SW $t2, 168($fp)
+LA $t2, immediate_2
+LW $t2, 0($t2)
+SW $t2, 0($t0)
+LA $t1, immediate_2
+LW $t1, 0($t1)
+LI $t3, 12
+MUL $t3, $t1, $t3
+SW $t4, 132($fp)
+ADDU $t4, $t5, $t3
+SW $t5, 0($t5)
+LA $t5, immediate_3
+LW $t5, 0($t5)
+LI $t8, 4
+SW $t6, 120($fp)
+MUL $t6, $t5, $t8
+SW $t7, 116($fp)
+ADDU $t7, $t4, $t6
+LW $t8, 0($t7)
+LW $fp, 180($sp)
+LW $ra, 184($sp)
+ADDIU $sp, $sp, 188
+JR $ra
+
@@ -0,0 +1,33 @@
+.data
+immediate_0: .word 3147483647
+immediate_1: .word 5
+immediate_2: .float 2.402823+38
+immediate_3: .double 4.402823+38
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -44
+SW $ra, 40($sp)
+SW $fp, 36($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+SLL $t2, $t1, 0
+SRA $t2, $t2, 0
+LA $t0, immediate_1
+LW $t3, 0($t0)
+LA $t0, immediate_2
+LWC1 $f2, 0($t0)
+LA $t0, immediate_3
+LDC1 $f4, 0($t0)
+CVT.S.D $f6, $f4
+LW $fp, 36($sp)
+LW $ra, 40($sp)
+ADDIU $sp, $sp, 44
+JR $ra
+
@@ -0,0 +1,44 @@
+.data
+immediate_0: .double 0
+immediate_1: .float 5.0
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -32
+SW $ra, 28($sp)
+SW $fp, 24($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LDC1 $f2, 0($t0)
+CVT.S.D $f4, $f2
+SDC1 $f2, 16($fp)
+SWC1 $f4, 12($fp)
+L3:
+LA $t0, immediate_1
+LWC1 $f2, 0($t0)
+LWC1 $f4, 12($fp)
+C.LT.S $f4, $f2
+BC1T L1
+NOP
+SWC1 $f2, 8($fp)
+J L1
+NOP
+L2:
+LWC1 $f2, 12($fp)
+LWC1 $f4, 12($fp)
+ADDIU $f4, $f4, 1
+SWC1 $f2, 0($fp)
+SWC1 $f4, 12($fp)
+J L3
+NOP
+L1:
+LW $fp, 24($sp)
+LW $ra, 28($sp)
+ADDIU $sp, $sp, 32
+JR $ra
+
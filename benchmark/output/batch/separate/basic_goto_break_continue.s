@@ -0,0 +1,44 @@
+.data
+immediate_0: .word 0
+immediate_1: .word 5
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -36
+SW $ra, 32($sp)
+SW $fp, 28($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+SW $t1, 20($fp)
+SW $t1, 16($fp)
+L3:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 16($fp)
+BLT $t2, $t1, L1
+NOP
+SW $t1, 12($fp)
+J L2
+NOP
+L1:
+LW $t0, 16($fp)
+LW $t1, 16($fp)
+ADDIU $t1, $t1, 1
+ADDIU $t2, $t1, 1
+SW $t0, 0($fp)
+SW $t1, 4($fp)
+SW $t2, 16($fp)
+J L3
+NOP
+L2:
+LW $fp, 28($sp)
+LW $ra, 32($sp)
+ADDIU $sp, $sp, 36
+JR $ra
+
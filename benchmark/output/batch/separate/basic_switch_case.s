@@ -0,0 +1,54 @@
+.data
+immediate_0: .word -100
+immediate_1: .word 2
+immediate_2: .word 1
+immediate_3: .word 3
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -40
+SW $ra, 36($sp)
+SW $fp, 32($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 28($fp)
+BEQ $t2, $t1, L1
+NOP
+LA $t0, immediate_1
+LW $t3, 0($t0)
+BEQ $t2, $t3, L2
+NOP
+SW $t1, 16($fp)
+SW $t2, 28($fp)
+SW $t3, 8($fp)
+J L3
+NOP
+L1:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+SW $t1, 12($fp)
+SW $t1, 24($fp)
+L2:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+SW $t1, 4($fp)
+SW $t1, 24($fp)
+J L4
+NOP
+L3:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+SW $t1, 0($fp)
+SW $t1, 24($fp)
+L4:
+LW $fp, 32($sp)
+LW $ra, 36($sp)
+ADDIU $sp, $sp, 40
+JR $ra
+
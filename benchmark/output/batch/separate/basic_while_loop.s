@@ -0,0 +1,42 @@
+.data
+immediate_0: .word 5
+immediate_1: .word 0
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -28
+SW $ra, 24($sp)
+SW $fp, 20($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+SW $t1, 16($fp)
+SW $t1, 12($fp)
+L3:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 12($fp)
+BGT $t2, $t1, L1
+NOP
+SW $t1, 8($fp)
+J L2
+NOP
+L1:
+LW $t0, 12($fp)
+LW $t1, 12($fp)
+ADDIU $t1, $t1, -1
+SW $t0, 0($fp)
+SW $t1, 12($fp)
+J L3
+NOP
+L2:
+LW $fp, 20($sp)
+LW $ra, 24($sp)
+ADDIU $sp, $sp, 28
+JR $ra
+
@@ -0,0 +1,29 @@
+.data
+immediate_0: .word 0
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -12
+SW $ra, 8($sp)
+SW $fp, 4($sp)
+MOVE $fp, $sp
+J L1
+NOP
+L2:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+MOVE $v0, $t1
+SW $t1, 0($fp)
+J L1
+NOP
+L1:
+LW $fp, 4($sp)
+LW $ra, 8($sp)
+ADDIU $sp, $sp, 12
+JR $ra
+
@@ -0,0 +1,31 @@
+.data
+immediate_0: .word 5
+immediate_1: .word 0
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+_f_main_S0__sig:
+ADDIU $sp, $sp, -20
+SW $ra, 16($sp)
+SW $fp, 12($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LA $t0, immediate_1
+LW $t2, 0($t0)
+MOVE $v0, $t2
+SW $t1, 8($fp)
+SW $t1, 4($fp)
+SW $t2, 0($fp)
+J L1
+NOP
+L1:
+LW $fp, 12($sp)
+LW $ra, 16($sp)
+ADDIU $sp, $sp, 20
+JR $ra
+
@@ -0,0 +1,8 @@
+const int func(int x, ...){
+    int y = 5;
+    return x+y;
+}
+
+int main(){
+    func(5,6,7);
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+// Passing
+
+int matrix[3][3];
+int main(){
+    int x = 9;
+    matrix[0][0] = 1;
+    x = matrix[1][2];
+    // matrix[0][1] = 2;
+    // matrix[0][2] = x;
+    // matrix[1][0] = 4;
+    // x = matrix[0][0] + matrix[0][1] + matrix[0][2];
+    // matrix[1][1] = 5;
+    // matrix[1][2] = 6;
+    // matrix[2][0] = 7;
+    // matrix[2][1] = 8;
+    // matrix[2][2] = 9;
+    // return x + matrix[1][0] + matrix[1][1] + matrix[1][2] + matrix[2][0] + matrix[2][1] + matrix[2][2]; 
+}
\ No newline at end of file
@@ -0,0 +1,8 @@
+int factorial(int n) {
+    if (n <= 1) return 1;
+    return n * factorial(n - 1);
+}
+int main(){
+    int result = factorial(5); 
+}
+ 
\ No newline at end of file
@@ -0,0 +1,9 @@
+// Passing
+
+typedef unsigned long long ULI;
+ULI number;
+
+int main() {
+    number = 4512548512;
+    return 0;
+}
\ No newline at end of file
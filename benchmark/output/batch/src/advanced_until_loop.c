@@ -0,0 +1,12 @@
+// Passing
+
+int printf(const char *format, ...){
+    return 0;
+}
+int n = 0;
+int main(){
+    until (n == 5) { 
+        printf("%d ", n);
+        n++;
+    }
+}
@@ -0,0 +1,80 @@
+// // // Passing
+// // int x;
+
+// // double main() {
+// //     int a = 10, b = 5;
+// // int sum = (a + b);
+// // int diff = a - b;
+// // int prod = a * b;
+// // int quot = a / b;
+// // int mod = a % b;
+// // int result = (((a > b) && (b < 15)) || !(a == b));
+// // int complea = (a + b) * (a - b) / 2;
+// // int logic = (a > b) && (b != 0) || (a < 50);
+// // float c = 5.5, d = 2.2;
+// // float f_prod = c * d;
+// // float f_quot = c / d;
+// // char ch = 'A';
+// // char next_ch = ch + 1;
+// //     // breakpoint;
+// //     // breakpoint_global;
+// // }
+
+// // int y;
+
+// int main()
+// {
+//     int a = 3;
+//     int b = a * 3;  // 9
+//     int c = b + 4;  // 13
+//     int d = c + 5;  // 18
+//     int e = d + 6;  // 24
+//     int f = e + 7;  // 31
+//     int g = f + 8;  // 39
+//     int h = g + 9;  // 48
+//     int i = h + 10; // 58
+//     int j = i + 11; // 69
+//     int k = j + 12; // 81
+//     int l = k + 13; // 94
+//     int m = l + 14; // 108
+//     int n = m + 15; // 123
+//     int o = n + 16; // 139
+
+//     // Use all variables again to force reload from memory
+//     int final = a + b + c + d + e + f + g + h + i + j + k + l + m + n + o;
+
+//     // printf("%d\n", final);
+//     return 0;
+// }
+
+int main()
+{
+    int a = 3147483647;
+    int b = 5;
+    // ++a;
+    // a = b;
+    // a--;
+    float c = 2.402823e+38;
+    float d = 4.402823e+38;
+    // float c = 5.5, d = 2.2;
+    // signed int sc = 1000;
+    // if ((a < b) || (a < c))
+    // {
+    //     a++;
+    // }
+    // int sum = (a + b);
+    // short diff = a - b;
+    // // long long prod = a * b;
+    // unsigned long quot = a / b;
+    // int mod = a % b;
+    // mod++;
+    // int result = (((a > b) && (b < 1.5)) || !(a == b));
+    // int complea = (a + b) * (a - b) / 2;
+    // int logic = (a > b) && (b != 0) || (a < 50);
+    // short k = logic;
+    // float f_prod = c * d;
+    // float f_quot = c / d;
+    // char ch = 'A';
+    // char next_ch = ch + 1;
+    
+}
@@ -0,0 +1,8 @@
+// Passing
+// TAC DONE
+
+int main(){
+    char c = 'a';
+    char d = '_';
+    char e = '\r';
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+// Passing
+// TAC DONE
+// MIPS Passing
+
+int main(){ 
+    int y = 5;
+    char z = '5';
+    do {
+        int x;
+        y--;
+    } while (y > 0);
+    int x;
+    do
+    {
+        int x;
+        z--;
+    } while (z > '0');
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+// Passing
+// TAC DONE
+
+// enum Color
+// {
+//     RED,
+//     GREEN,
+//     BLUE
+// };
+
+int main()
+{
+    // for(int i=0; i<10; i++){
+    //     if(i == 1) break;
+    //     if(i == 2) continue;
+    // }
+    for (float i = 0.0; i < 5.0; i++);
+    // int i = 0;
+    // for (; i < 5; i++)
+    // {
+    //     int k =5;
+    // }
+    // for (int i = 0;; i++)
+    // {
+    //     break;
+    // }
+    // for (int i = 0; i < 3;)
+    // {
+    //     i++;
+    // }
+    // for (;;)
+    // {
+    //     break;
+    // }
+
+    // enum Color c;
+    // for (c = RED; c <= BLUE; c++)
+    // {
+    //     int val = c;
+    // }
+
+    // for (i = 0; i < 3; i++)
+    // {
+    //     for (int j = 0; j < 2; j++)
+    //     {
+    //         int k = i + j;
+    //     }
+    // }
+}
\ No newline at end of file
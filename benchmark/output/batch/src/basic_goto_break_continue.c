@@ -0,0 +1,17 @@
+// Passing 
+// TAC DONE
+
+int main(){
+    int x;
+    // label1:
+    for (int i = 0; i < 5; i++) {
+        // if (i == 2) continue;
+        // if (i == 4) break;
+        i++;
+        //printf("%d ", i);
+    }
+    // goto label;
+    // label: x = 1;
+    // //printf("Jumped here\n");
+    // goto label1;
+}
@@ -0,0 +1,18 @@
+// Passing
+// MIPS passed
+int main()
+{
+    int a = 5, b = 0;
+    if (a > b)
+        a = a - b;
+    else if (a == 2)
+        if (a > b)
+            a = a - b;
+        else 
+            a= a + b;
+    else
+    {
+        int x;
+        b = b - x;
+    }
+}
@@ -0,0 +1,9 @@
+// Passing
+// Explicit typecasting is failing
+
+int p = 10;
+int *ptr = &p;
+int main(){
+    *ptr = 20;
+    // int **pp = &ptr;
+}
@@ -0,0 +1,17 @@
+// Passing
+
+// void printf(const char *format){
+//     // Dummy implementation for demonstration
+// }
+
+
+int main(){
+    int num;
+    int x;
+    switch (num) {
+        case -100: {x=1; }
+        case 2: x=2;
+        break;
+        default: x=3;
+    }
+}
\ No newline at end of file
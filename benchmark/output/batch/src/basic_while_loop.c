@@ -0,0 +1,9 @@
+// Passing
+// Passing MIPS
+
+int main(){
+    int x = 5;
+    while (x > 0) {
+        x--;
+    }
+}
@@ -0,0 +1 @@
+enum Colors { RED, GREEN, BLUE }; int main() { enum Colors c; c = 5; return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+typedef int MyInt; MyInt x = "hello";
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { int x = 5; int y = x + "world"; return 0; }
\ No newline at end of file
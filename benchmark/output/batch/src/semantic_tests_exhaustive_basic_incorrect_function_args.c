@@ -0,0 +1 @@
+int sum(int a, int b) { return a + b; } int main() { int s = sum(10); return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { if ("hello") return 1; return 0; }
\ No newline at end of file
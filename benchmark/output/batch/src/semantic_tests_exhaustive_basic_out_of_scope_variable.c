@@ -0,0 +1 @@
+int main() { { int a = 10; } a = 5; return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { int x = 5; int x = 10; return 0; }
\ No newline at end of file
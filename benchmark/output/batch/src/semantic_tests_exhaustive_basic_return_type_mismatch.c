@@ -0,0 +1 @@
+int foo() { return "hello"; }
\ No newline at end of file
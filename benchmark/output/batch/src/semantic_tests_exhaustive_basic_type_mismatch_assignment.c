@@ -0,0 +1 @@
+int main() { int x = 5; x = "hello"; return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { int y = square(5); return 0; }
\ No newline at end of file
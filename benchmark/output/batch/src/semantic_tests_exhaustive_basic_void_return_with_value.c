@@ -0,0 +1 @@
+void foo() { return 42; }
\ No newline at end of file
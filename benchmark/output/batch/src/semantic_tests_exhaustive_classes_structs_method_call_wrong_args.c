@@ -0,0 +1 @@
+class A { public: void foo(int x); }; int main() { A a; a.foo(); return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+struct S { int a; }; int main() { S s; s.a = "abc"; return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { continue; return 0; }
\ No newline at end of file
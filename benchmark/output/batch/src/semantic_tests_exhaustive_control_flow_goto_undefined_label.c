@@ -0,0 +1 @@
+int main() { goto label; return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { switch("string") { case 1: break; } return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { until("invalid") { } return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int square(int x) { return x * x; } int main() { float (*fp)(int) = square; return 0; }
\ No newline at end of file
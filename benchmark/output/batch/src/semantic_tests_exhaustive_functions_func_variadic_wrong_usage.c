@@ -0,0 +1,3 @@
+#include <stdarg.h>
+int sum(int count, ...) { return 0; }
+int main() { sum(); return 0; }
\ No newline at end of file
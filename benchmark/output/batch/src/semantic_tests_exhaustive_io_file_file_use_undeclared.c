@@ -0,0 +1,2 @@
+#include <stdio.h>
+int main() { FILE *fp = open("file.txt", "r"); return 0; }
\ No newline at end of file
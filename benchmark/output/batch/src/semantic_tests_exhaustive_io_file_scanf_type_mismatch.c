@@ -0,0 +1,2 @@
+#include <stdio.h>
+int main() { int x; scanf("%s", &x); return 0; }
\ No newline at end of file
@@ -0,0 +1 @@
+int main() { int arr[5]; arr["two"] = 2; return 0; }
\ No newline at end of file
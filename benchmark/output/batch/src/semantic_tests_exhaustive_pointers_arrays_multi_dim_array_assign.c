@@ -0,0 +1 @@
+int main() { int mat[2][2]; mat[0][0] = "str"; return 0; }
\ No newline at end of file
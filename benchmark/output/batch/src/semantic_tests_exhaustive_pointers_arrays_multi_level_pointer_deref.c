@@ -0,0 +1 @@
+int main() { int x = 5; int ***ppp = &&x; return 0; }
\ No newline at end of file
@@ -0,0 +1,6 @@
+int main() {
+    if x > 0) {
+        return 1;
+    }
+    return 0;
+}
\ No newline at end of file
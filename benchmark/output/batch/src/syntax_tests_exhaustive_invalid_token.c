@@ -0,0 +1,4 @@
+int main() {
+    int x = 5 @ 3; // Error: '@' is not a valid token
+    return 0;
+}
\ No newline at end of file
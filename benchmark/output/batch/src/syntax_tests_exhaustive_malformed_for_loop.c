@@ -0,0 +1,5 @@
+int main() {
+    for (int i = 0 i < 10; i++) {
+        return i;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,3 @@
+int main( {
+    return 0;
+} // Error: Missing closing parenthesis in function declaration
\ No newline at end of file
@@ -0,0 +1,4 @@
+int main() {
+    int x = 5 // Error: Missing semicolon
+    return 0;
+}
\ No newline at end of file
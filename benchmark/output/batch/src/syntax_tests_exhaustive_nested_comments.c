@@ -0,0 +1,4 @@
+int main() {
+    /* This is /* a nested */ comment */
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,4 @@
+int main() {
+    char *s = "Hello;
+    return 0;
+}
\ No newline at end of file
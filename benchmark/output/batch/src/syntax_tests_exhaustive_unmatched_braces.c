@@ -0,0 +1,3 @@
+int main() {
+    int x = 10;
+// Missing closing brace
\ No newline at end of file
@@ -0,0 +1,2806 @@
+int g0 = 1;
+int f0(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f1(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f2(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f3(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f4(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f5(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f6(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f7(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f8(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f9(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f10(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f11(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f12(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f13(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f14(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f15(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f16(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f17(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f18(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f19(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f20(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f21(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f22(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f23(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f24(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f25(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f26(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f27(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f28(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f29(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f30(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f31(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f32(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f33(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f34(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f35(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f36(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f37(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f38(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f39(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f40(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f41(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f42(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f43(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f44(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f45(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f46(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f47(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f48(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f49(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f50(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f51(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f52(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f53(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f54(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f55(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f56(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f57(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f58(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f59(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f60(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f61(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f62(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f63(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f64(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f65(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f66(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f67(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f68(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f69(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f70(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f71(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f72(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f73(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f74(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f75(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f76(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f77(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f78(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f79(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f80(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f81(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f82(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f83(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f84(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f85(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f86(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f87(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f88(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f89(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f90(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f91(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f92(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f93(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f94(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f95(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f96(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f97(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f98(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f99(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    int unused = 0;
+    while (unused < 100) { unused = unused + 1; }
+    x = x + y * 0;
+    if (x > y) { x = x - 1; } else { y = y + 1; }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 4;
+    if (x > y) { x = x - 5; } else { y = y + 5; }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 8;
+    if (x > y) { x = x - 9; } else { y = y + 9; }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 12;
+    if (x > y) { x = x - 13; } else { y = y + 13; }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + y * 16;
+    if (x > y) { x = x - 17; } else { y = y + 17; }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int main()
+{
+    int s = f0(1, 2);
+    return 0;
+}
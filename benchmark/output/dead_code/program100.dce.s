@@ -0,0 +1,33060 @@
+.data
+_v_g0_S0: .word 1
+immediate_0: .word 2
+immediate_1: .word 0
+immediate_2: .word 1
+immediate_3: .word 4
+immediate_4: .word 5
+immediate_5: .word 6
+immediate_6: .word 8
+immediate_7: .word 9
+immediate_8: .word 10
+immediate_9: .word 12
+immediate_10: .word 13
+immediate_11: .word 14
+immediate_12: .word 16
+immediate_13: .word 17
+immediate_14: .word 18
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+L1:
+_f_f0_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2
+NOP
+L2:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L3
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L4
+NOP
+L3:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L5
+NOP
+L4:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L5:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L6
+NOP
+SW $t1, 248($fp)
+J L7
+NOP
+L6:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L5
+NOP
+L7:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L8
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L9
+NOP
+L8:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L10
+NOP
+L9:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L10:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L11
+NOP
+SW $t1, 192($fp)
+J L12
+NOP
+L11:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L10
+NOP
+L12:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L13
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L14
+NOP
+L13:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L15
+NOP
+L14:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L15:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L16
+NOP
+SW $t1, 136($fp)
+J L17
+NOP
+L16:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L15
+NOP
+L17:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L18
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L19
+NOP
+L18:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L20
+NOP
+L19:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L20:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L21
+NOP
+SW $t1, 80($fp)
+J L22
+NOP
+L21:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L20
+NOP
+L22:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L23
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L24
+NOP
+L23:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L25
+NOP
+L24:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L25:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L26
+NOP
+SW $t1, 24($fp)
+J L27
+NOP
+L26:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L25
+NOP
+L27:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L28
+NOP
+L28:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f1_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L29
+NOP
+L29:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L30
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L31
+NOP
+L30:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L32
+NOP
+L31:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L32:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L33
+NOP
+SW $t1, 248($fp)
+J L34
+NOP
+L33:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L32
+NOP
+L34:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L35
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L36
+NOP
+L35:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L37
+NOP
+L36:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L37:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L38
+NOP
+SW $t1, 192($fp)
+J L39
+NOP
+L38:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L37
+NOP
+L39:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L40
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L41
+NOP
+L40:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L42
+NOP
+L41:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L42:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L43
+NOP
+SW $t1, 136($fp)
+J L44
+NOP
+L43:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L42
+NOP
+L44:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L45
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L46
+NOP
+L45:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L47
+NOP
+L46:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L47:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L48
+NOP
+SW $t1, 80($fp)
+J L49
+NOP
+L48:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L47
+NOP
+L49:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L50
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L51
+NOP
+L50:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L52
+NOP
+L51:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L52:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L53
+NOP
+SW $t1, 24($fp)
+J L54
+NOP
+L53:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L52
+NOP
+L54:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L55
+NOP
+L55:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f2_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L56
+NOP
+L56:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L57
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L58
+NOP
+L57:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L59
+NOP
+L58:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L59:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L60
+NOP
+SW $t1, 248($fp)
+J L61
+NOP
+L60:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L59
+NOP
+L61:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L62
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L63
+NOP
+L62:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L64
+NOP
+L63:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L64:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L65
+NOP
+SW $t1, 192($fp)
+J L66
+NOP
+L65:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L64
+NOP
+L66:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L67
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L68
+NOP
+L67:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L69
+NOP
+L68:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L69:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L70
+NOP
+SW $t1, 136($fp)
+J L71
+NOP
+L70:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L69
+NOP
+L71:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L72
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L73
+NOP
+L72:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L74
+NOP
+L73:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L74:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L75
+NOP
+SW $t1, 80($fp)
+J L76
+NOP
+L75:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L74
+NOP
+L76:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L77
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L78
+NOP
+L77:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L79
+NOP
+L78:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L79:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L80
+NOP
+SW $t1, 24($fp)
+J L81
+NOP
+L80:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L79
+NOP
+L81:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L82
+NOP
+L82:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f3_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L83
+NOP
+L83:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L84
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L85
+NOP
+L84:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L86
+NOP
+L85:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L86:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L87
+NOP
+SW $t1, 248($fp)
+J L88
+NOP
+L87:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L86
+NOP
+L88:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L89
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L90
+NOP
+L89:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L91
+NOP
+L90:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L91:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L92
+NOP
+SW $t1, 192($fp)
+J L93
+NOP
+L92:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L91
+NOP
+L93:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L94
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L95
+NOP
+L94:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L96
+NOP
+L95:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L96:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L97
+NOP
+SW $t1, 136($fp)
+J L98
+NOP
+L97:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L96
+NOP
+L98:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L99
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L100
+NOP
+L99:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L101
+NOP
+L100:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L101:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L102
+NOP
+SW $t1, 80($fp)
+J L103
+NOP
+L102:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L101
+NOP
+L103:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L104
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L105
+NOP
+L104:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L106
+NOP
+L105:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L106:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L107
+NOP
+SW $t1, 24($fp)
+J L108
+NOP
+L107:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L106
+NOP
+L108:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L109
+NOP
+L109:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f4_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L110
+NOP
+L110:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L111
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L112
+NOP
+L111:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L113
+NOP
+L112:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L113:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L114
+NOP
+SW $t1, 248($fp)
+J L115
+NOP
+L114:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L113
+NOP
+L115:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L116
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L117
+NOP
+L116:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L118
+NOP
+L117:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L118:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L119
+NOP
+SW $t1, 192($fp)
+J L120
+NOP
+L119:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L118
+NOP
+L120:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L121
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L122
+NOP
+L121:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L123
+NOP
+L122:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L123:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L124
+NOP
+SW $t1, 136($fp)
+J L125
+NOP
+L124:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L123
+NOP
+L125:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L126
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L127
+NOP
+L126:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L128
+NOP
+L127:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L128:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L129
+NOP
+SW $t1, 80($fp)
+J L130
+NOP
+L129:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L128
+NOP
+L130:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L131
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L132
+NOP
+L131:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L133
+NOP
+L132:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L133:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L134
+NOP
+SW $t1, 24($fp)
+J L135
+NOP
+L134:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L133
+NOP
+L135:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L136
+NOP
+L136:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f5_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L137
+NOP
+L137:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L138
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L139
+NOP
+L138:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L140
+NOP
+L139:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L140:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L141
+NOP
+SW $t1, 248($fp)
+J L142
+NOP
+L141:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L140
+NOP
+L142:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L143
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L144
+NOP
+L143:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L145
+NOP
+L144:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L145:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L146
+NOP
+SW $t1, 192($fp)
+J L147
+NOP
+L146:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L145
+NOP
+L147:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L148
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L149
+NOP
+L148:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L150
+NOP
+L149:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L150:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L151
+NOP
+SW $t1, 136($fp)
+J L152
+NOP
+L151:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L150
+NOP
+L152:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L153
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L154
+NOP
+L153:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L155
+NOP
+L154:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L155:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L156
+NOP
+SW $t1, 80($fp)
+J L157
+NOP
+L156:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L155
+NOP
+L157:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L158
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L159
+NOP
+L158:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L160
+NOP
+L159:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L160:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L161
+NOP
+SW $t1, 24($fp)
+J L162
+NOP
+L161:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L160
+NOP
+L162:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L163
+NOP
+L163:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f6_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L164
+NOP
+L164:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L165
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L166
+NOP
+L165:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L167
+NOP
+L166:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L167:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L168
+NOP
+SW $t1, 248($fp)
+J L169
+NOP
+L168:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L167
+NOP
+L169:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L170
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L171
+NOP
+L170:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L172
+NOP
+L171:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L172:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L173
+NOP
+SW $t1, 192($fp)
+J L174
+NOP
+L173:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L172
+NOP
+L174:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L175
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L176
+NOP
+L175:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L177
+NOP
+L176:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L177:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L178
+NOP
+SW $t1, 136($fp)
+J L179
+NOP
+L178:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L177
+NOP
+L179:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L180
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L181
+NOP
+L180:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L182
+NOP
+L181:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L182:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L183
+NOP
+SW $t1, 80($fp)
+J L184
+NOP
+L183:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L182
+NOP
+L184:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L185
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L186
+NOP
+L185:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L187
+NOP
+L186:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L187:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L188
+NOP
+SW $t1, 24($fp)
+J L189
+NOP
+L188:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L187
+NOP
+L189:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L190
+NOP
+L190:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f7_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L191
+NOP
+L191:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L192
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L193
+NOP
+L192:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L194
+NOP
+L193:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L194:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L195
+NOP
+SW $t1, 248($fp)
+J L196
+NOP
+L195:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L194
+NOP
+L196:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L197
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L198
+NOP
+L197:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L199
+NOP
+L198:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L199:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L200
+NOP
+SW $t1, 192($fp)
+J L201
+NOP
+L200:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L199
+NOP
+L201:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L202
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L203
+NOP
+L202:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L204
+NOP
+L203:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L204:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L205
+NOP
+SW $t1, 136($fp)
+J L206
+NOP
+L205:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L204
+NOP
+L206:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L207
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L208
+NOP
+L207:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L209
+NOP
+L208:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L209:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L210
+NOP
+SW $t1, 80($fp)
+J L211
+NOP
+L210:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L209
+NOP
+L211:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L212
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L213
+NOP
+L212:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L214
+NOP
+L213:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L214:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L215
+NOP
+SW $t1, 24($fp)
+J L216
+NOP
+L215:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L214
+NOP
+L216:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L217
+NOP
+L217:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f8_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L218
+NOP
+L218:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L219
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L220
+NOP
+L219:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L221
+NOP
+L220:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L221:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L222
+NOP
+SW $t1, 248($fp)
+J L223
+NOP
+L222:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L221
+NOP
+L223:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L224
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L225
+NOP
+L224:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L226
+NOP
+L225:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L226:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L227
+NOP
+SW $t1, 192($fp)
+J L228
+NOP
+L227:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L226
+NOP
+L228:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L229
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L230
+NOP
+L229:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L231
+NOP
+L230:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L231:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L232
+NOP
+SW $t1, 136($fp)
+J L233
+NOP
+L232:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L231
+NOP
+L233:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L234
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L235
+NOP
+L234:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L236
+NOP
+L235:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L236:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L237
+NOP
+SW $t1, 80($fp)
+J L238
+NOP
+L237:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L236
+NOP
+L238:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L239
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L240
+NOP
+L239:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L241
+NOP
+L240:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L241:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L242
+NOP
+SW $t1, 24($fp)
+J L243
+NOP
+L242:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L241
+NOP
+L243:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L244
+NOP
+L244:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f9_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L245
+NOP
+L245:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L246
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L247
+NOP
+L246:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L248
+NOP
+L247:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L248:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L249
+NOP
+SW $t1, 248($fp)
+J L250
+NOP
+L249:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L248
+NOP
+L250:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L251
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L252
+NOP
+L251:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L253
+NOP
+L252:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L253:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L254
+NOP
+SW $t1, 192($fp)
+J L255
+NOP
+L254:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L253
+NOP
+L255:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L256
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L257
+NOP
+L256:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L258
+NOP
+L257:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L258:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L259
+NOP
+SW $t1, 136($fp)
+J L260
+NOP
+L259:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L258
+NOP
+L260:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L261
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L262
+NOP
+L261:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L263
+NOP
+L262:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L263:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L264
+NOP
+SW $t1, 80($fp)
+J L265
+NOP
+L264:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L263
+NOP
+L265:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L266
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L267
+NOP
+L266:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L268
+NOP
+L267:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L268:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L269
+NOP
+SW $t1, 24($fp)
+J L270
+NOP
+L269:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L268
+NOP
+L270:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L271
+NOP
+L271:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f10_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L272
+NOP
+L272:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L273
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L274
+NOP
+L273:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L275
+NOP
+L274:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L275:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L276
+NOP
+SW $t1, 248($fp)
+J L277
+NOP
+L276:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L275
+NOP
+L277:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L278
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L279
+NOP
+L278:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L280
+NOP
+L279:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L280:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L281
+NOP
+SW $t1, 192($fp)
+J L282
+NOP
+L281:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L280
+NOP
+L282:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L283
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L284
+NOP
+L283:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L285
+NOP
+L284:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L285:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L286
+NOP
+SW $t1, 136($fp)
+J L287
+NOP
+L286:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L285
+NOP
+L287:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L288
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L289
+NOP
+L288:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L290
+NOP
+L289:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L290:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L291
+NOP
+SW $t1, 80($fp)
+J L292
+NOP
+L291:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L290
+NOP
+L292:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L293
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L294
+NOP
+L293:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L295
+NOP
+L294:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L295:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L296
+NOP
+SW $t1, 24($fp)
+J L297
+NOP
+L296:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L295
+NOP
+L297:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L298
+NOP
+L298:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f11_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L299
+NOP
+L299:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L300
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L301
+NOP
+L300:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L302
+NOP
+L301:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L302:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L303
+NOP
+SW $t1, 248($fp)
+J L304
+NOP
+L303:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L302
+NOP
+L304:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L305
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L306
+NOP
+L305:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L307
+NOP
+L306:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L307:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L308
+NOP
+SW $t1, 192($fp)
+J L309
+NOP
+L308:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L307
+NOP
+L309:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L310
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L311
+NOP
+L310:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L312
+NOP
+L311:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L312:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L313
+NOP
+SW $t1, 136($fp)
+J L314
+NOP
+L313:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L312
+NOP
+L314:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L315
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L316
+NOP
+L315:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L317
+NOP
+L316:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L317:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L318
+NOP
+SW $t1, 80($fp)
+J L319
+NOP
+L318:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L317
+NOP
+L319:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L320
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L321
+NOP
+L320:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L322
+NOP
+L321:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L322:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L323
+NOP
+SW $t1, 24($fp)
+J L324
+NOP
+L323:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L322
+NOP
+L324:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L325
+NOP
+L325:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f12_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L326
+NOP
+L326:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L327
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L328
+NOP
+L327:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L329
+NOP
+L328:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L329:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L330
+NOP
+SW $t1, 248($fp)
+J L331
+NOP
+L330:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L329
+NOP
+L331:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L332
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L333
+NOP
+L332:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L334
+NOP
+L333:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L334:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L335
+NOP
+SW $t1, 192($fp)
+J L336
+NOP
+L335:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L334
+NOP
+L336:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L337
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L338
+NOP
+L337:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L339
+NOP
+L338:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L339:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L340
+NOP
+SW $t1, 136($fp)
+J L341
+NOP
+L340:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L339
+NOP
+L341:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L342
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L343
+NOP
+L342:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L344
+NOP
+L343:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L344:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L345
+NOP
+SW $t1, 80($fp)
+J L346
+NOP
+L345:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L344
+NOP
+L346:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L347
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L348
+NOP
+L347:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L349
+NOP
+L348:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L349:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L350
+NOP
+SW $t1, 24($fp)
+J L351
+NOP
+L350:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L349
+NOP
+L351:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L352
+NOP
+L352:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f13_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L353
+NOP
+L353:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L354
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L355
+NOP
+L354:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L356
+NOP
+L355:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L356:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L357
+NOP
+SW $t1, 248($fp)
+J L358
+NOP
+L357:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L356
+NOP
+L358:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L359
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L360
+NOP
+L359:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L361
+NOP
+L360:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L361:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L362
+NOP
+SW $t1, 192($fp)
+J L363
+NOP
+L362:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L361
+NOP
+L363:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L364
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L365
+NOP
+L364:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L366
+NOP
+L365:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L366:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L367
+NOP
+SW $t1, 136($fp)
+J L368
+NOP
+L367:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L366
+NOP
+L368:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L369
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L370
+NOP
+L369:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L371
+NOP
+L370:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L371:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L372
+NOP
+SW $t1, 80($fp)
+J L373
+NOP
+L372:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L371
+NOP
+L373:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L374
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L375
+NOP
+L374:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L376
+NOP
+L375:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L376:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L377
+NOP
+SW $t1, 24($fp)
+J L378
+NOP
+L377:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L376
+NOP
+L378:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L379
+NOP
+L379:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f14_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L380
+NOP
+L380:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L381
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L382
+NOP
+L381:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L383
+NOP
+L382:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L383:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L384
+NOP
+SW $t1, 248($fp)
+J L385
+NOP
+L384:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L383
+NOP
+L385:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L386
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L387
+NOP
+L386:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L388
+NOP
+L387:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L388:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L389
+NOP
+SW $t1, 192($fp)
+J L390
+NOP
+L389:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L388
+NOP
+L390:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L391
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L392
+NOP
+L391:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L393
+NOP
+L392:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L393:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L394
+NOP
+SW $t1, 136($fp)
+J L395
+NOP
+L394:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L393
+NOP
+L395:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L396
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L397
+NOP
+L396:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L398
+NOP
+L397:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L398:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L399
+NOP
+SW $t1, 80($fp)
+J L400
+NOP
+L399:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L398
+NOP
+L400:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L401
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L402
+NOP
+L401:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L403
+NOP
+L402:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L403:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L404
+NOP
+SW $t1, 24($fp)
+J L405
+NOP
+L404:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L403
+NOP
+L405:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L406
+NOP
+L406:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f15_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L407
+NOP
+L407:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L408
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L409
+NOP
+L408:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L410
+NOP
+L409:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L410:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L411
+NOP
+SW $t1, 248($fp)
+J L412
+NOP
+L411:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L410
+NOP
+L412:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L413
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L414
+NOP
+L413:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L415
+NOP
+L414:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L415:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L416
+NOP
+SW $t1, 192($fp)
+J L417
+NOP
+L416:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L415
+NOP
+L417:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L418
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L419
+NOP
+L418:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L420
+NOP
+L419:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L420:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L421
+NOP
+SW $t1, 136($fp)
+J L422
+NOP
+L421:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L420
+NOP
+L422:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L423
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L424
+NOP
+L423:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L425
+NOP
+L424:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L425:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L426
+NOP
+SW $t1, 80($fp)
+J L427
+NOP
+L426:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L425
+NOP
+L427:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L428
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L429
+NOP
+L428:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L430
+NOP
+L429:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L430:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L431
+NOP
+SW $t1, 24($fp)
+J L432
+NOP
+L431:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L430
+NOP
+L432:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L433
+NOP
+L433:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f16_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L434
+NOP
+L434:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L435
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L436
+NOP
+L435:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L437
+NOP
+L436:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L437:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L438
+NOP
+SW $t1, 248($fp)
+J L439
+NOP
+L438:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L437
+NOP
+L439:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L440
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L441
+NOP
+L440:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L442
+NOP
+L441:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L442:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L443
+NOP
+SW $t1, 192($fp)
+J L444
+NOP
+L443:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L442
+NOP
+L444:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L445
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L446
+NOP
+L445:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L447
+NOP
+L446:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L447:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L448
+NOP
+SW $t1, 136($fp)
+J L449
+NOP
+L448:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L447
+NOP
+L449:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L450
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L451
+NOP
+L450:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L452
+NOP
+L451:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L452:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L453
+NOP
+SW $t1, 80($fp)
+J L454
+NOP
+L453:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L452
+NOP
+L454:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L455
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L456
+NOP
+L455:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L457
+NOP
+L456:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L457:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L458
+NOP
+SW $t1, 24($fp)
+J L459
+NOP
+L458:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L457
+NOP
+L459:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L460
+NOP
+L460:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f17_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L461
+NOP
+L461:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L462
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L463
+NOP
+L462:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L464
+NOP
+L463:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L464:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L465
+NOP
+SW $t1, 248($fp)
+J L466
+NOP
+L465:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L464
+NOP
+L466:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L467
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L468
+NOP
+L467:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L469
+NOP
+L468:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L469:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L470
+NOP
+SW $t1, 192($fp)
+J L471
+NOP
+L470:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L469
+NOP
+L471:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L472
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L473
+NOP
+L472:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L474
+NOP
+L473:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L474:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L475
+NOP
+SW $t1, 136($fp)
+J L476
+NOP
+L475:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L474
+NOP
+L476:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L477
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L478
+NOP
+L477:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L479
+NOP
+L478:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L479:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L480
+NOP
+SW $t1, 80($fp)
+J L481
+NOP
+L480:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L479
+NOP
+L481:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L482
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L483
+NOP
+L482:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L484
+NOP
+L483:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L484:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L485
+NOP
+SW $t1, 24($fp)
+J L486
+NOP
+L485:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L484
+NOP
+L486:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L487
+NOP
+L487:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f18_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L488
+NOP
+L488:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L489
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L490
+NOP
+L489:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L491
+NOP
+L490:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L491:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L492
+NOP
+SW $t1, 248($fp)
+J L493
+NOP
+L492:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L491
+NOP
+L493:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L494
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L495
+NOP
+L494:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L496
+NOP
+L495:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L496:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L497
+NOP
+SW $t1, 192($fp)
+J L498
+NOP
+L497:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L496
+NOP
+L498:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L499
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L500
+NOP
+L499:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L501
+NOP
+L500:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L501:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L502
+NOP
+SW $t1, 136($fp)
+J L503
+NOP
+L502:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L501
+NOP
+L503:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L504
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L505
+NOP
+L504:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L506
+NOP
+L505:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L506:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L507
+NOP
+SW $t1, 80($fp)
+J L508
+NOP
+L507:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L506
+NOP
+L508:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L509
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L510
+NOP
+L509:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L511
+NOP
+L510:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L511:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L512
+NOP
+SW $t1, 24($fp)
+J L513
+NOP
+L512:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L511
+NOP
+L513:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L514
+NOP
+L514:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f19_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L515
+NOP
+L515:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L516
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L517
+NOP
+L516:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L518
+NOP
+L517:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L518:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L519
+NOP
+SW $t1, 248($fp)
+J L520
+NOP
+L519:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L518
+NOP
+L520:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L521
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L522
+NOP
+L521:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L523
+NOP
+L522:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L523:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L524
+NOP
+SW $t1, 192($fp)
+J L525
+NOP
+L524:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L523
+NOP
+L525:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L526
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L527
+NOP
+L526:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L528
+NOP
+L527:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L528:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L529
+NOP
+SW $t1, 136($fp)
+J L530
+NOP
+L529:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L528
+NOP
+L530:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L531
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L532
+NOP
+L531:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L533
+NOP
+L532:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L533:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L534
+NOP
+SW $t1, 80($fp)
+J L535
+NOP
+L534:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L533
+NOP
+L535:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L536
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L537
+NOP
+L536:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L538
+NOP
+L537:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L538:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L539
+NOP
+SW $t1, 24($fp)
+J L540
+NOP
+L539:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L538
+NOP
+L540:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L541
+NOP
+L541:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f20_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L542
+NOP
+L542:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L543
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L544
+NOP
+L543:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L545
+NOP
+L544:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L545:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L546
+NOP
+SW $t1, 248($fp)
+J L547
+NOP
+L546:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L545
+NOP
+L547:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L548
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L549
+NOP
+L548:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L550
+NOP
+L549:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L550:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L551
+NOP
+SW $t1, 192($fp)
+J L552
+NOP
+L551:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L550
+NOP
+L552:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L553
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L554
+NOP
+L553:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L555
+NOP
+L554:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L555:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L556
+NOP
+SW $t1, 136($fp)
+J L557
+NOP
+L556:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L555
+NOP
+L557:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L558
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L559
+NOP
+L558:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L560
+NOP
+L559:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L560:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L561
+NOP
+SW $t1, 80($fp)
+J L562
+NOP
+L561:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L560
+NOP
+L562:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L563
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L564
+NOP
+L563:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L565
+NOP
+L564:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L565:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L566
+NOP
+SW $t1, 24($fp)
+J L567
+NOP
+L566:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L565
+NOP
+L567:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L568
+NOP
+L568:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f21_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L569
+NOP
+L569:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L570
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L571
+NOP
+L570:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L572
+NOP
+L571:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L572:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L573
+NOP
+SW $t1, 248($fp)
+J L574
+NOP
+L573:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L572
+NOP
+L574:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L575
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L576
+NOP
+L575:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L577
+NOP
+L576:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L577:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L578
+NOP
+SW $t1, 192($fp)
+J L579
+NOP
+L578:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L577
+NOP
+L579:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L580
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L581
+NOP
+L580:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L582
+NOP
+L581:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L582:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L583
+NOP
+SW $t1, 136($fp)
+J L584
+NOP
+L583:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L582
+NOP
+L584:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L585
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L586
+NOP
+L585:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L587
+NOP
+L586:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L587:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L588
+NOP
+SW $t1, 80($fp)
+J L589
+NOP
+L588:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L587
+NOP
+L589:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L590
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L591
+NOP
+L590:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L592
+NOP
+L591:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L592:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L593
+NOP
+SW $t1, 24($fp)
+J L594
+NOP
+L593:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L592
+NOP
+L594:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L595
+NOP
+L595:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f22_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L596
+NOP
+L596:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L597
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L598
+NOP
+L597:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L599
+NOP
+L598:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L599:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L600
+NOP
+SW $t1, 248($fp)
+J L601
+NOP
+L600:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L599
+NOP
+L601:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L602
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L603
+NOP
+L602:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L604
+NOP
+L603:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L604:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L605
+NOP
+SW $t1, 192($fp)
+J L606
+NOP
+L605:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L604
+NOP
+L606:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L607
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L608
+NOP
+L607:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L609
+NOP
+L608:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L609:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L610
+NOP
+SW $t1, 136($fp)
+J L611
+NOP
+L610:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L609
+NOP
+L611:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L612
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L613
+NOP
+L612:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L614
+NOP
+L613:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L614:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L615
+NOP
+SW $t1, 80($fp)
+J L616
+NOP
+L615:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L614
+NOP
+L616:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L617
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L618
+NOP
+L617:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L619
+NOP
+L618:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L619:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L620
+NOP
+SW $t1, 24($fp)
+J L621
+NOP
+L620:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L619
+NOP
+L621:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L622
+NOP
+L622:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f23_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L623
+NOP
+L623:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L624
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L625
+NOP
+L624:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L626
+NOP
+L625:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L626:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L627
+NOP
+SW $t1, 248($fp)
+J L628
+NOP
+L627:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L626
+NOP
+L628:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L629
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L630
+NOP
+L629:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L631
+NOP
+L630:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L631:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L632
+NOP
+SW $t1, 192($fp)
+J L633
+NOP
+L632:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L631
+NOP
+L633:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L634
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L635
+NOP
+L634:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L636
+NOP
+L635:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L636:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L637
+NOP
+SW $t1, 136($fp)
+J L638
+NOP
+L637:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L636
+NOP
+L638:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L639
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L640
+NOP
+L639:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L641
+NOP
+L640:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L641:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L642
+NOP
+SW $t1, 80($fp)
+J L643
+NOP
+L642:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L641
+NOP
+L643:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L644
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L645
+NOP
+L644:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L646
+NOP
+L645:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L646:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L647
+NOP
+SW $t1, 24($fp)
+J L648
+NOP
+L647:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L646
+NOP
+L648:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L649
+NOP
+L649:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f24_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L650
+NOP
+L650:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L651
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L652
+NOP
+L651:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L653
+NOP
+L652:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L653:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L654
+NOP
+SW $t1, 248($fp)
+J L655
+NOP
+L654:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L653
+NOP
+L655:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L656
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L657
+NOP
+L656:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L658
+NOP
+L657:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L658:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L659
+NOP
+SW $t1, 192($fp)
+J L660
+NOP
+L659:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L658
+NOP
+L660:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L661
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L662
+NOP
+L661:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L663
+NOP
+L662:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L663:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L664
+NOP
+SW $t1, 136($fp)
+J L665
+NOP
+L664:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L663
+NOP
+L665:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L666
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L667
+NOP
+L666:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L668
+NOP
+L667:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L668:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L669
+NOP
+SW $t1, 80($fp)
+J L670
+NOP
+L669:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L668
+NOP
+L670:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L671
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L672
+NOP
+L671:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L673
+NOP
+L672:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L673:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L674
+NOP
+SW $t1, 24($fp)
+J L675
+NOP
+L674:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L673
+NOP
+L675:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L676
+NOP
+L676:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f25_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L677
+NOP
+L677:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L678
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L679
+NOP
+L678:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L680
+NOP
+L679:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L680:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L681
+NOP
+SW $t1, 248($fp)
+J L682
+NOP
+L681:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L680
+NOP
+L682:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L683
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L684
+NOP
+L683:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L685
+NOP
+L684:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L685:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L686
+NOP
+SW $t1, 192($fp)
+J L687
+NOP
+L686:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L685
+NOP
+L687:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L688
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L689
+NOP
+L688:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L690
+NOP
+L689:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L690:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L691
+NOP
+SW $t1, 136($fp)
+J L692
+NOP
+L691:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L690
+NOP
+L692:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L693
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L694
+NOP
+L693:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L695
+NOP
+L694:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L695:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L696
+NOP
+SW $t1, 80($fp)
+J L697
+NOP
+L696:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L695
+NOP
+L697:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L698
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L699
+NOP
+L698:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L700
+NOP
+L699:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L700:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L701
+NOP
+SW $t1, 24($fp)
+J L702
+NOP
+L701:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L700
+NOP
+L702:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L703
+NOP
+L703:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f26_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L704
+NOP
+L704:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L705
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L706
+NOP
+L705:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L707
+NOP
+L706:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L707:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L708
+NOP
+SW $t1, 248($fp)
+J L709
+NOP
+L708:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L707
+NOP
+L709:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L710
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L711
+NOP
+L710:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L712
+NOP
+L711:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L712:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L713
+NOP
+SW $t1, 192($fp)
+J L714
+NOP
+L713:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L712
+NOP
+L714:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L715
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L716
+NOP
+L715:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L717
+NOP
+L716:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L717:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L718
+NOP
+SW $t1, 136($fp)
+J L719
+NOP
+L718:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L717
+NOP
+L719:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L720
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L721
+NOP
+L720:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L722
+NOP
+L721:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L722:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L723
+NOP
+SW $t1, 80($fp)
+J L724
+NOP
+L723:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L722
+NOP
+L724:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L725
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L726
+NOP
+L725:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L727
+NOP
+L726:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L727:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L728
+NOP
+SW $t1, 24($fp)
+J L729
+NOP
+L728:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L727
+NOP
+L729:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L730
+NOP
+L730:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f27_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L731
+NOP
+L731:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L732
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L733
+NOP
+L732:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L734
+NOP
+L733:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L734:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L735
+NOP
+SW $t1, 248($fp)
+J L736
+NOP
+L735:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L734
+NOP
+L736:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L737
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L738
+NOP
+L737:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L739
+NOP
+L738:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L739:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L740
+NOP
+SW $t1, 192($fp)
+J L741
+NOP
+L740:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L739
+NOP
+L741:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L742
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L743
+NOP
+L742:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L744
+NOP
+L743:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L744:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L745
+NOP
+SW $t1, 136($fp)
+J L746
+NOP
+L745:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L744
+NOP
+L746:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L747
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L748
+NOP
+L747:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L749
+NOP
+L748:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L749:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L750
+NOP
+SW $t1, 80($fp)
+J L751
+NOP
+L750:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L749
+NOP
+L751:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L752
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L753
+NOP
+L752:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L754
+NOP
+L753:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L754:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L755
+NOP
+SW $t1, 24($fp)
+J L756
+NOP
+L755:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L754
+NOP
+L756:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L757
+NOP
+L757:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f28_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L758
+NOP
+L758:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L759
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L760
+NOP
+L759:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L761
+NOP
+L760:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L761:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L762
+NOP
+SW $t1, 248($fp)
+J L763
+NOP
+L762:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L761
+NOP
+L763:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L764
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L765
+NOP
+L764:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L766
+NOP
+L765:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L766:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L767
+NOP
+SW $t1, 192($fp)
+J L768
+NOP
+L767:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L766
+NOP
+L768:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L769
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L770
+NOP
+L769:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L771
+NOP
+L770:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L771:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L772
+NOP
+SW $t1, 136($fp)
+J L773
+NOP
+L772:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L771
+NOP
+L773:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L774
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L775
+NOP
+L774:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L776
+NOP
+L775:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L776:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L777
+NOP
+SW $t1, 80($fp)
+J L778
+NOP
+L777:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L776
+NOP
+L778:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L779
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L780
+NOP
+L779:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L781
+NOP
+L780:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L781:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L782
+NOP
+SW $t1, 24($fp)
+J L783
+NOP
+L782:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L781
+NOP
+L783:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L784
+NOP
+L784:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f29_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L785
+NOP
+L785:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L786
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L787
+NOP
+L786:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L788
+NOP
+L787:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L788:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L789
+NOP
+SW $t1, 248($fp)
+J L790
+NOP
+L789:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L788
+NOP
+L790:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L791
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L792
+NOP
+L791:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L793
+NOP
+L792:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L793:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L794
+NOP
+SW $t1, 192($fp)
+J L795
+NOP
+L794:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L793
+NOP
+L795:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L796
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L797
+NOP
+L796:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L798
+NOP
+L797:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L798:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L799
+NOP
+SW $t1, 136($fp)
+J L800
+NOP
+L799:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L798
+NOP
+L800:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L801
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L802
+NOP
+L801:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L803
+NOP
+L802:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L803:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L804
+NOP
+SW $t1, 80($fp)
+J L805
+NOP
+L804:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L803
+NOP
+L805:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L806
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L807
+NOP
+L806:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L808
+NOP
+L807:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L808:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L809
+NOP
+SW $t1, 24($fp)
+J L810
+NOP
+L809:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L808
+NOP
+L810:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L811
+NOP
+L811:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f30_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L812
+NOP
+L812:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L813
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L814
+NOP
+L813:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L815
+NOP
+L814:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L815:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L816
+NOP
+SW $t1, 248($fp)
+J L817
+NOP
+L816:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L815
+NOP
+L817:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L818
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L819
+NOP
+L818:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L820
+NOP
+L819:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L820:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L821
+NOP
+SW $t1, 192($fp)
+J L822
+NOP
+L821:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L820
+NOP
+L822:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L823
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L824
+NOP
+L823:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L825
+NOP
+L824:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L825:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L826
+NOP
+SW $t1, 136($fp)
+J L827
+NOP
+L826:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L825
+NOP
+L827:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L828
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L829
+NOP
+L828:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L830
+NOP
+L829:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L830:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L831
+NOP
+SW $t1, 80($fp)
+J L832
+NOP
+L831:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L830
+NOP
+L832:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L833
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L834
+NOP
+L833:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L835
+NOP
+L834:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L835:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L836
+NOP
+SW $t1, 24($fp)
+J L837
+NOP
+L836:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L835
+NOP
+L837:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L838
+NOP
+L838:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f31_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L839
+NOP
+L839:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L840
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L841
+NOP
+L840:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L842
+NOP
+L841:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L842:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L843
+NOP
+SW $t1, 248($fp)
+J L844
+NOP
+L843:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L842
+NOP
+L844:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L845
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L846
+NOP
+L845:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L847
+NOP
+L846:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L847:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L848
+NOP
+SW $t1, 192($fp)
+J L849
+NOP
+L848:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L847
+NOP
+L849:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L850
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L851
+NOP
+L850:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L852
+NOP
+L851:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L852:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L853
+NOP
+SW $t1, 136($fp)
+J L854
+NOP
+L853:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L852
+NOP
+L854:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L855
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L856
+NOP
+L855:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L857
+NOP
+L856:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L857:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L858
+NOP
+SW $t1, 80($fp)
+J L859
+NOP
+L858:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L857
+NOP
+L859:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L860
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L861
+NOP
+L860:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L862
+NOP
+L861:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L862:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L863
+NOP
+SW $t1, 24($fp)
+J L864
+NOP
+L863:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L862
+NOP
+L864:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L865
+NOP
+L865:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f32_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L866
+NOP
+L866:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L867
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L868
+NOP
+L867:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L869
+NOP
+L868:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L869:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L870
+NOP
+SW $t1, 248($fp)
+J L871
+NOP
+L870:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L869
+NOP
+L871:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L872
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L873
+NOP
+L872:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L874
+NOP
+L873:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L874:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L875
+NOP
+SW $t1, 192($fp)
+J L876
+NOP
+L875:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L874
+NOP
+L876:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L877
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L878
+NOP
+L877:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L879
+NOP
+L878:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L879:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L880
+NOP
+SW $t1, 136($fp)
+J L881
+NOP
+L880:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L879
+NOP
+L881:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L882
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L883
+NOP
+L882:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L884
+NOP
+L883:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L884:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L885
+NOP
+SW $t1, 80($fp)
+J L886
+NOP
+L885:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L884
+NOP
+L886:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L887
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L888
+NOP
+L887:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L889
+NOP
+L888:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L889:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L890
+NOP
+SW $t1, 24($fp)
+J L891
+NOP
+L890:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L889
+NOP
+L891:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L892
+NOP
+L892:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f33_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L893
+NOP
+L893:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L894
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L895
+NOP
+L894:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L896
+NOP
+L895:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L896:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L897
+NOP
+SW $t1, 248($fp)
+J L898
+NOP
+L897:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L896
+NOP
+L898:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L899
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L900
+NOP
+L899:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L901
+NOP
+L900:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L901:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L902
+NOP
+SW $t1, 192($fp)
+J L903
+NOP
+L902:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L901
+NOP
+L903:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L904
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L905
+NOP
+L904:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L906
+NOP
+L905:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L906:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L907
+NOP
+SW $t1, 136($fp)
+J L908
+NOP
+L907:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L906
+NOP
+L908:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L909
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L910
+NOP
+L909:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L911
+NOP
+L910:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L911:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L912
+NOP
+SW $t1, 80($fp)
+J L913
+NOP
+L912:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L911
+NOP
+L913:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L914
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L915
+NOP
+L914:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L916
+NOP
+L915:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L916:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L917
+NOP
+SW $t1, 24($fp)
+J L918
+NOP
+L917:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L916
+NOP
+L918:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L919
+NOP
+L919:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f34_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L920
+NOP
+L920:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L921
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L922
+NOP
+L921:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L923
+NOP
+L922:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L923:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L924
+NOP
+SW $t1, 248($fp)
+J L925
+NOP
+L924:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L923
+NOP
+L925:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L926
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L927
+NOP
+L926:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L928
+NOP
+L927:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L928:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L929
+NOP
+SW $t1, 192($fp)
+J L930
+NOP
+L929:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L928
+NOP
+L930:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L931
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L932
+NOP
+L931:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L933
+NOP
+L932:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L933:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L934
+NOP
+SW $t1, 136($fp)
+J L935
+NOP
+L934:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L933
+NOP
+L935:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L936
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L937
+NOP
+L936:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L938
+NOP
+L937:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L938:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L939
+NOP
+SW $t1, 80($fp)
+J L940
+NOP
+L939:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L938
+NOP
+L940:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L941
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L942
+NOP
+L941:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L943
+NOP
+L942:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L943:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L944
+NOP
+SW $t1, 24($fp)
+J L945
+NOP
+L944:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L943
+NOP
+L945:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L946
+NOP
+L946:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f35_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L947
+NOP
+L947:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L948
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L949
+NOP
+L948:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L950
+NOP
+L949:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L950:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L951
+NOP
+SW $t1, 248($fp)
+J L952
+NOP
+L951:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L950
+NOP
+L952:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L953
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L954
+NOP
+L953:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L955
+NOP
+L954:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L955:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L956
+NOP
+SW $t1, 192($fp)
+J L957
+NOP
+L956:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L955
+NOP
+L957:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L958
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L959
+NOP
+L958:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L960
+NOP
+L959:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L960:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L961
+NOP
+SW $t1, 136($fp)
+J L962
+NOP
+L961:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L960
+NOP
+L962:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L963
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L964
+NOP
+L963:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L965
+NOP
+L964:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L965:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L966
+NOP
+SW $t1, 80($fp)
+J L967
+NOP
+L966:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L965
+NOP
+L967:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L968
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L969
+NOP
+L968:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L970
+NOP
+L969:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L970:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L971
+NOP
+SW $t1, 24($fp)
+J L972
+NOP
+L971:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L970
+NOP
+L972:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L973
+NOP
+L973:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f36_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L974
+NOP
+L974:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L975
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L976
+NOP
+L975:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L977
+NOP
+L976:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L977:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L978
+NOP
+SW $t1, 248($fp)
+J L979
+NOP
+L978:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L977
+NOP
+L979:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L980
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L981
+NOP
+L980:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L982
+NOP
+L981:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L982:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L983
+NOP
+SW $t1, 192($fp)
+J L984
+NOP
+L983:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L982
+NOP
+L984:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L985
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L986
+NOP
+L985:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L987
+NOP
+L986:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L987:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L988
+NOP
+SW $t1, 136($fp)
+J L989
+NOP
+L988:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L987
+NOP
+L989:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L990
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L991
+NOP
+L990:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L992
+NOP
+L991:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L992:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L993
+NOP
+SW $t1, 80($fp)
+J L994
+NOP
+L993:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L992
+NOP
+L994:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L995
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L996
+NOP
+L995:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L997
+NOP
+L996:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L997:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L998
+NOP
+SW $t1, 24($fp)
+J L999
+NOP
+L998:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L997
+NOP
+L999:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1000
+NOP
+L1000:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f37_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1001
+NOP
+L1001:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1002
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1003
+NOP
+L1002:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1004
+NOP
+L1003:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1004:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1005
+NOP
+SW $t1, 248($fp)
+J L1006
+NOP
+L1005:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1004
+NOP
+L1006:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1007
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1008
+NOP
+L1007:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1009
+NOP
+L1008:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1009:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1010
+NOP
+SW $t1, 192($fp)
+J L1011
+NOP
+L1010:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1009
+NOP
+L1011:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1012
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1013
+NOP
+L1012:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1014
+NOP
+L1013:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1014:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1015
+NOP
+SW $t1, 136($fp)
+J L1016
+NOP
+L1015:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1014
+NOP
+L1016:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1017
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1018
+NOP
+L1017:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1019
+NOP
+L1018:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1019:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1020
+NOP
+SW $t1, 80($fp)
+J L1021
+NOP
+L1020:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1019
+NOP
+L1021:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1022
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1023
+NOP
+L1022:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1024
+NOP
+L1023:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1024:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1025
+NOP
+SW $t1, 24($fp)
+J L1026
+NOP
+L1025:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1024
+NOP
+L1026:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1027
+NOP
+L1027:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f38_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1028
+NOP
+L1028:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1029
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1030
+NOP
+L1029:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1031
+NOP
+L1030:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1031:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1032
+NOP
+SW $t1, 248($fp)
+J L1033
+NOP
+L1032:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1031
+NOP
+L1033:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1034
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1035
+NOP
+L1034:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1036
+NOP
+L1035:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1036:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1037
+NOP
+SW $t1, 192($fp)
+J L1038
+NOP
+L1037:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1036
+NOP
+L1038:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1039
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1040
+NOP
+L1039:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1041
+NOP
+L1040:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1041:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1042
+NOP
+SW $t1, 136($fp)
+J L1043
+NOP
+L1042:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1041
+NOP
+L1043:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1044
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1045
+NOP
+L1044:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1046
+NOP
+L1045:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1046:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1047
+NOP
+SW $t1, 80($fp)
+J L1048
+NOP
+L1047:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1046
+NOP
+L1048:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1049
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1050
+NOP
+L1049:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1051
+NOP
+L1050:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1051:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1052
+NOP
+SW $t1, 24($fp)
+J L1053
+NOP
+L1052:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1051
+NOP
+L1053:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1054
+NOP
+L1054:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f39_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1055
+NOP
+L1055:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1056
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1057
+NOP
+L1056:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1058
+NOP
+L1057:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1058:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1059
+NOP
+SW $t1, 248($fp)
+J L1060
+NOP
+L1059:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1058
+NOP
+L1060:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1061
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1062
+NOP
+L1061:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1063
+NOP
+L1062:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1063:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1064
+NOP
+SW $t1, 192($fp)
+J L1065
+NOP
+L1064:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1063
+NOP
+L1065:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1066
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1067
+NOP
+L1066:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1068
+NOP
+L1067:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1068:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1069
+NOP
+SW $t1, 136($fp)
+J L1070
+NOP
+L1069:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1068
+NOP
+L1070:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1071
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1072
+NOP
+L1071:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1073
+NOP
+L1072:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1073:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1074
+NOP
+SW $t1, 80($fp)
+J L1075
+NOP
+L1074:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1073
+NOP
+L1075:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1076
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1077
+NOP
+L1076:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1078
+NOP
+L1077:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1078:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1079
+NOP
+SW $t1, 24($fp)
+J L1080
+NOP
+L1079:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1078
+NOP
+L1080:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1081
+NOP
+L1081:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f40_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1082
+NOP
+L1082:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1083
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1084
+NOP
+L1083:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1085
+NOP
+L1084:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1085:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1086
+NOP
+SW $t1, 248($fp)
+J L1087
+NOP
+L1086:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1085
+NOP
+L1087:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1088
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1089
+NOP
+L1088:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1090
+NOP
+L1089:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1090:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1091
+NOP
+SW $t1, 192($fp)
+J L1092
+NOP
+L1091:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1090
+NOP
+L1092:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1093
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1094
+NOP
+L1093:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1095
+NOP
+L1094:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1095:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1096
+NOP
+SW $t1, 136($fp)
+J L1097
+NOP
+L1096:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1095
+NOP
+L1097:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1098
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1099
+NOP
+L1098:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1100
+NOP
+L1099:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1100:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1101
+NOP
+SW $t1, 80($fp)
+J L1102
+NOP
+L1101:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1100
+NOP
+L1102:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1103
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1104
+NOP
+L1103:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1105
+NOP
+L1104:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1105:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1106
+NOP
+SW $t1, 24($fp)
+J L1107
+NOP
+L1106:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1105
+NOP
+L1107:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1108
+NOP
+L1108:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f41_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1109
+NOP
+L1109:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1110
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1111
+NOP
+L1110:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1112
+NOP
+L1111:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1112:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1113
+NOP
+SW $t1, 248($fp)
+J L1114
+NOP
+L1113:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1112
+NOP
+L1114:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1115
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1116
+NOP
+L1115:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1117
+NOP
+L1116:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1117:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1118
+NOP
+SW $t1, 192($fp)
+J L1119
+NOP
+L1118:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1117
+NOP
+L1119:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1120
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1121
+NOP
+L1120:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1122
+NOP
+L1121:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1122:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1123
+NOP
+SW $t1, 136($fp)
+J L1124
+NOP
+L1123:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1122
+NOP
+L1124:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1125
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1126
+NOP
+L1125:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1127
+NOP
+L1126:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1127:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1128
+NOP
+SW $t1, 80($fp)
+J L1129
+NOP
+L1128:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1127
+NOP
+L1129:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1130
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1131
+NOP
+L1130:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1132
+NOP
+L1131:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1132:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1133
+NOP
+SW $t1, 24($fp)
+J L1134
+NOP
+L1133:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1132
+NOP
+L1134:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1135
+NOP
+L1135:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f42_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1136
+NOP
+L1136:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1137
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1138
+NOP
+L1137:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1139
+NOP
+L1138:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1139:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1140
+NOP
+SW $t1, 248($fp)
+J L1141
+NOP
+L1140:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1139
+NOP
+L1141:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1142
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1143
+NOP
+L1142:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1144
+NOP
+L1143:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1144:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1145
+NOP
+SW $t1, 192($fp)
+J L1146
+NOP
+L1145:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1144
+NOP
+L1146:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1147
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1148
+NOP
+L1147:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1149
+NOP
+L1148:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1149:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1150
+NOP
+SW $t1, 136($fp)
+J L1151
+NOP
+L1150:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1149
+NOP
+L1151:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1152
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1153
+NOP
+L1152:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1154
+NOP
+L1153:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1154:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1155
+NOP
+SW $t1, 80($fp)
+J L1156
+NOP
+L1155:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1154
+NOP
+L1156:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1157
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1158
+NOP
+L1157:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1159
+NOP
+L1158:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1159:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1160
+NOP
+SW $t1, 24($fp)
+J L1161
+NOP
+L1160:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1159
+NOP
+L1161:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1162
+NOP
+L1162:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f43_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1163
+NOP
+L1163:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1164
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1165
+NOP
+L1164:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1166
+NOP
+L1165:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1166:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1167
+NOP
+SW $t1, 248($fp)
+J L1168
+NOP
+L1167:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1166
+NOP
+L1168:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1169
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1170
+NOP
+L1169:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1171
+NOP
+L1170:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1171:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1172
+NOP
+SW $t1, 192($fp)
+J L1173
+NOP
+L1172:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1171
+NOP
+L1173:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1174
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1175
+NOP
+L1174:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1176
+NOP
+L1175:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1176:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1177
+NOP
+SW $t1, 136($fp)
+J L1178
+NOP
+L1177:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1176
+NOP
+L1178:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1179
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1180
+NOP
+L1179:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1181
+NOP
+L1180:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1181:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1182
+NOP
+SW $t1, 80($fp)
+J L1183
+NOP
+L1182:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1181
+NOP
+L1183:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1184
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1185
+NOP
+L1184:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1186
+NOP
+L1185:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1186:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1187
+NOP
+SW $t1, 24($fp)
+J L1188
+NOP
+L1187:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1186
+NOP
+L1188:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1189
+NOP
+L1189:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f44_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1190
+NOP
+L1190:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1191
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1192
+NOP
+L1191:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1193
+NOP
+L1192:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1193:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1194
+NOP
+SW $t1, 248($fp)
+J L1195
+NOP
+L1194:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1193
+NOP
+L1195:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1196
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1197
+NOP
+L1196:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1198
+NOP
+L1197:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1198:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1199
+NOP
+SW $t1, 192($fp)
+J L1200
+NOP
+L1199:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1198
+NOP
+L1200:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1201
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1202
+NOP
+L1201:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1203
+NOP
+L1202:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1203:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1204
+NOP
+SW $t1, 136($fp)
+J L1205
+NOP
+L1204:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1203
+NOP
+L1205:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1206
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1207
+NOP
+L1206:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1208
+NOP
+L1207:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1208:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1209
+NOP
+SW $t1, 80($fp)
+J L1210
+NOP
+L1209:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1208
+NOP
+L1210:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1211
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1212
+NOP
+L1211:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1213
+NOP
+L1212:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1213:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1214
+NOP
+SW $t1, 24($fp)
+J L1215
+NOP
+L1214:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1213
+NOP
+L1215:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1216
+NOP
+L1216:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f45_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1217
+NOP
+L1217:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1218
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1219
+NOP
+L1218:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1220
+NOP
+L1219:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1220:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1221
+NOP
+SW $t1, 248($fp)
+J L1222
+NOP
+L1221:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1220
+NOP
+L1222:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1223
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1224
+NOP
+L1223:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1225
+NOP
+L1224:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1225:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1226
+NOP
+SW $t1, 192($fp)
+J L1227
+NOP
+L1226:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1225
+NOP
+L1227:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1228
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1229
+NOP
+L1228:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1230
+NOP
+L1229:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1230:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1231
+NOP
+SW $t1, 136($fp)
+J L1232
+NOP
+L1231:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1230
+NOP
+L1232:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1233
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1234
+NOP
+L1233:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1235
+NOP
+L1234:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1235:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1236
+NOP
+SW $t1, 80($fp)
+J L1237
+NOP
+L1236:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1235
+NOP
+L1237:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1238
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1239
+NOP
+L1238:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1240
+NOP
+L1239:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1240:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1241
+NOP
+SW $t1, 24($fp)
+J L1242
+NOP
+L1241:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1240
+NOP
+L1242:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1243
+NOP
+L1243:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f46_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1244
+NOP
+L1244:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1245
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1246
+NOP
+L1245:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1247
+NOP
+L1246:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1247:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1248
+NOP
+SW $t1, 248($fp)
+J L1249
+NOP
+L1248:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1247
+NOP
+L1249:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1250
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1251
+NOP
+L1250:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1252
+NOP
+L1251:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1252:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1253
+NOP
+SW $t1, 192($fp)
+J L1254
+NOP
+L1253:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1252
+NOP
+L1254:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1255
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1256
+NOP
+L1255:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1257
+NOP
+L1256:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1257:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1258
+NOP
+SW $t1, 136($fp)
+J L1259
+NOP
+L1258:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1257
+NOP
+L1259:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1260
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1261
+NOP
+L1260:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1262
+NOP
+L1261:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1262:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1263
+NOP
+SW $t1, 80($fp)
+J L1264
+NOP
+L1263:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1262
+NOP
+L1264:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1265
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1266
+NOP
+L1265:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1267
+NOP
+L1266:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1267:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1268
+NOP
+SW $t1, 24($fp)
+J L1269
+NOP
+L1268:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1267
+NOP
+L1269:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1270
+NOP
+L1270:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f47_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1271
+NOP
+L1271:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1272
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1273
+NOP
+L1272:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1274
+NOP
+L1273:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1274:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1275
+NOP
+SW $t1, 248($fp)
+J L1276
+NOP
+L1275:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1274
+NOP
+L1276:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1277
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1278
+NOP
+L1277:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1279
+NOP
+L1278:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1279:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1280
+NOP
+SW $t1, 192($fp)
+J L1281
+NOP
+L1280:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1279
+NOP
+L1281:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1282
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1283
+NOP
+L1282:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1284
+NOP
+L1283:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1284:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1285
+NOP
+SW $t1, 136($fp)
+J L1286
+NOP
+L1285:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1284
+NOP
+L1286:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1287
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1288
+NOP
+L1287:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1289
+NOP
+L1288:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1289:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1290
+NOP
+SW $t1, 80($fp)
+J L1291
+NOP
+L1290:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1289
+NOP
+L1291:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1292
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1293
+NOP
+L1292:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1294
+NOP
+L1293:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1294:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1295
+NOP
+SW $t1, 24($fp)
+J L1296
+NOP
+L1295:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1294
+NOP
+L1296:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1297
+NOP
+L1297:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f48_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1298
+NOP
+L1298:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1299
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1300
+NOP
+L1299:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1301
+NOP
+L1300:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1301:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1302
+NOP
+SW $t1, 248($fp)
+J L1303
+NOP
+L1302:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1301
+NOP
+L1303:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1304
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1305
+NOP
+L1304:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1306
+NOP
+L1305:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1306:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1307
+NOP
+SW $t1, 192($fp)
+J L1308
+NOP
+L1307:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1306
+NOP
+L1308:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1309
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1310
+NOP
+L1309:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1311
+NOP
+L1310:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1311:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1312
+NOP
+SW $t1, 136($fp)
+J L1313
+NOP
+L1312:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1311
+NOP
+L1313:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1314
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1315
+NOP
+L1314:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1316
+NOP
+L1315:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1316:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1317
+NOP
+SW $t1, 80($fp)
+J L1318
+NOP
+L1317:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1316
+NOP
+L1318:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1319
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1320
+NOP
+L1319:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1321
+NOP
+L1320:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1321:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1322
+NOP
+SW $t1, 24($fp)
+J L1323
+NOP
+L1322:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1321
+NOP
+L1323:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1324
+NOP
+L1324:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f49_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1325
+NOP
+L1325:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1326
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1327
+NOP
+L1326:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1328
+NOP
+L1327:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1328:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1329
+NOP
+SW $t1, 248($fp)
+J L1330
+NOP
+L1329:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1328
+NOP
+L1330:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1331
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1332
+NOP
+L1331:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1333
+NOP
+L1332:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1333:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1334
+NOP
+SW $t1, 192($fp)
+J L1335
+NOP
+L1334:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1333
+NOP
+L1335:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1336
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1337
+NOP
+L1336:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1338
+NOP
+L1337:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1338:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1339
+NOP
+SW $t1, 136($fp)
+J L1340
+NOP
+L1339:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1338
+NOP
+L1340:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1341
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1342
+NOP
+L1341:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1343
+NOP
+L1342:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1343:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1344
+NOP
+SW $t1, 80($fp)
+J L1345
+NOP
+L1344:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1343
+NOP
+L1345:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1346
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1347
+NOP
+L1346:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1348
+NOP
+L1347:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1348:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1349
+NOP
+SW $t1, 24($fp)
+J L1350
+NOP
+L1349:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1348
+NOP
+L1350:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1351
+NOP
+L1351:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f50_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1352
+NOP
+L1352:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1353
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1354
+NOP
+L1353:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1355
+NOP
+L1354:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1355:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1356
+NOP
+SW $t1, 248($fp)
+J L1357
+NOP
+L1356:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1355
+NOP
+L1357:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1358
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1359
+NOP
+L1358:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1360
+NOP
+L1359:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1360:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1361
+NOP
+SW $t1, 192($fp)
+J L1362
+NOP
+L1361:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1360
+NOP
+L1362:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1363
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1364
+NOP
+L1363:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1365
+NOP
+L1364:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1365:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1366
+NOP
+SW $t1, 136($fp)
+J L1367
+NOP
+L1366:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1365
+NOP
+L1367:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1368
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1369
+NOP
+L1368:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1370
+NOP
+L1369:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1370:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1371
+NOP
+SW $t1, 80($fp)
+J L1372
+NOP
+L1371:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1370
+NOP
+L1372:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1373
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1374
+NOP
+L1373:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1375
+NOP
+L1374:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1375:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1376
+NOP
+SW $t1, 24($fp)
+J L1377
+NOP
+L1376:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1375
+NOP
+L1377:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1378
+NOP
+L1378:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f51_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1379
+NOP
+L1379:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1380
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1381
+NOP
+L1380:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1382
+NOP
+L1381:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1382:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1383
+NOP
+SW $t1, 248($fp)
+J L1384
+NOP
+L1383:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1382
+NOP
+L1384:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1385
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1386
+NOP
+L1385:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1387
+NOP
+L1386:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1387:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1388
+NOP
+SW $t1, 192($fp)
+J L1389
+NOP
+L1388:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1387
+NOP
+L1389:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1390
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1391
+NOP
+L1390:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1392
+NOP
+L1391:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1392:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1393
+NOP
+SW $t1, 136($fp)
+J L1394
+NOP
+L1393:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1392
+NOP
+L1394:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1395
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1396
+NOP
+L1395:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1397
+NOP
+L1396:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1397:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1398
+NOP
+SW $t1, 80($fp)
+J L1399
+NOP
+L1398:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1397
+NOP
+L1399:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1400
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1401
+NOP
+L1400:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1402
+NOP
+L1401:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1402:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1403
+NOP
+SW $t1, 24($fp)
+J L1404
+NOP
+L1403:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1402
+NOP
+L1404:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1405
+NOP
+L1405:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f52_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1406
+NOP
+L1406:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1407
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1408
+NOP
+L1407:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1409
+NOP
+L1408:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1409:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1410
+NOP
+SW $t1, 248($fp)
+J L1411
+NOP
+L1410:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1409
+NOP
+L1411:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1412
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1413
+NOP
+L1412:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1414
+NOP
+L1413:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1414:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1415
+NOP
+SW $t1, 192($fp)
+J L1416
+NOP
+L1415:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1414
+NOP
+L1416:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1417
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1418
+NOP
+L1417:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1419
+NOP
+L1418:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1419:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1420
+NOP
+SW $t1, 136($fp)
+J L1421
+NOP
+L1420:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1419
+NOP
+L1421:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1422
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1423
+NOP
+L1422:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1424
+NOP
+L1423:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1424:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1425
+NOP
+SW $t1, 80($fp)
+J L1426
+NOP
+L1425:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1424
+NOP
+L1426:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1427
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1428
+NOP
+L1427:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1429
+NOP
+L1428:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1429:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1430
+NOP
+SW $t1, 24($fp)
+J L1431
+NOP
+L1430:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1429
+NOP
+L1431:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1432
+NOP
+L1432:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f53_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1433
+NOP
+L1433:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1434
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1435
+NOP
+L1434:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1436
+NOP
+L1435:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1436:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1437
+NOP
+SW $t1, 248($fp)
+J L1438
+NOP
+L1437:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1436
+NOP
+L1438:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1439
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1440
+NOP
+L1439:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1441
+NOP
+L1440:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1441:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1442
+NOP
+SW $t1, 192($fp)
+J L1443
+NOP
+L1442:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1441
+NOP
+L1443:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1444
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1445
+NOP
+L1444:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1446
+NOP
+L1445:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1446:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1447
+NOP
+SW $t1, 136($fp)
+J L1448
+NOP
+L1447:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1446
+NOP
+L1448:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1449
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1450
+NOP
+L1449:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1451
+NOP
+L1450:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1451:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1452
+NOP
+SW $t1, 80($fp)
+J L1453
+NOP
+L1452:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1451
+NOP
+L1453:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1454
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1455
+NOP
+L1454:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1456
+NOP
+L1455:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1456:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1457
+NOP
+SW $t1, 24($fp)
+J L1458
+NOP
+L1457:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1456
+NOP
+L1458:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1459
+NOP
+L1459:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f54_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1460
+NOP
+L1460:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1461
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1462
+NOP
+L1461:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1463
+NOP
+L1462:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1463:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1464
+NOP
+SW $t1, 248($fp)
+J L1465
+NOP
+L1464:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1463
+NOP
+L1465:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1466
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1467
+NOP
+L1466:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1468
+NOP
+L1467:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1468:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1469
+NOP
+SW $t1, 192($fp)
+J L1470
+NOP
+L1469:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1468
+NOP
+L1470:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1471
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1472
+NOP
+L1471:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1473
+NOP
+L1472:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1473:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1474
+NOP
+SW $t1, 136($fp)
+J L1475
+NOP
+L1474:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1473
+NOP
+L1475:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1476
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1477
+NOP
+L1476:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1478
+NOP
+L1477:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1478:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1479
+NOP
+SW $t1, 80($fp)
+J L1480
+NOP
+L1479:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1478
+NOP
+L1480:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1481
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1482
+NOP
+L1481:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1483
+NOP
+L1482:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1483:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1484
+NOP
+SW $t1, 24($fp)
+J L1485
+NOP
+L1484:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1483
+NOP
+L1485:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1486
+NOP
+L1486:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f55_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1487
+NOP
+L1487:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1488
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1489
+NOP
+L1488:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1490
+NOP
+L1489:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1490:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1491
+NOP
+SW $t1, 248($fp)
+J L1492
+NOP
+L1491:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1490
+NOP
+L1492:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1493
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1494
+NOP
+L1493:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1495
+NOP
+L1494:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1495:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1496
+NOP
+SW $t1, 192($fp)
+J L1497
+NOP
+L1496:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1495
+NOP
+L1497:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1498
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1499
+NOP
+L1498:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1500
+NOP
+L1499:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1500:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1501
+NOP
+SW $t1, 136($fp)
+J L1502
+NOP
+L1501:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1500
+NOP
+L1502:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1503
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1504
+NOP
+L1503:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1505
+NOP
+L1504:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1505:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1506
+NOP
+SW $t1, 80($fp)
+J L1507
+NOP
+L1506:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1505
+NOP
+L1507:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1508
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1509
+NOP
+L1508:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1510
+NOP
+L1509:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1510:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1511
+NOP
+SW $t1, 24($fp)
+J L1512
+NOP
+L1511:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1510
+NOP
+L1512:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1513
+NOP
+L1513:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f56_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1514
+NOP
+L1514:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1515
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1516
+NOP
+L1515:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1517
+NOP
+L1516:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1517:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1518
+NOP
+SW $t1, 248($fp)
+J L1519
+NOP
+L1518:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1517
+NOP
+L1519:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1520
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1521
+NOP
+L1520:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1522
+NOP
+L1521:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1522:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1523
+NOP
+SW $t1, 192($fp)
+J L1524
+NOP
+L1523:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1522
+NOP
+L1524:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1525
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1526
+NOP
+L1525:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1527
+NOP
+L1526:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1527:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1528
+NOP
+SW $t1, 136($fp)
+J L1529
+NOP
+L1528:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1527
+NOP
+L1529:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1530
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1531
+NOP
+L1530:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1532
+NOP
+L1531:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1532:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1533
+NOP
+SW $t1, 80($fp)
+J L1534
+NOP
+L1533:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1532
+NOP
+L1534:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1535
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1536
+NOP
+L1535:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1537
+NOP
+L1536:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1537:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1538
+NOP
+SW $t1, 24($fp)
+J L1539
+NOP
+L1538:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1537
+NOP
+L1539:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1540
+NOP
+L1540:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f57_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1541
+NOP
+L1541:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1542
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1543
+NOP
+L1542:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1544
+NOP
+L1543:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1544:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1545
+NOP
+SW $t1, 248($fp)
+J L1546
+NOP
+L1545:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1544
+NOP
+L1546:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1547
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1548
+NOP
+L1547:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1549
+NOP
+L1548:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1549:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1550
+NOP
+SW $t1, 192($fp)
+J L1551
+NOP
+L1550:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1549
+NOP
+L1551:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1552
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1553
+NOP
+L1552:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1554
+NOP
+L1553:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1554:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1555
+NOP
+SW $t1, 136($fp)
+J L1556
+NOP
+L1555:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1554
+NOP
+L1556:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1557
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1558
+NOP
+L1557:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1559
+NOP
+L1558:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1559:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1560
+NOP
+SW $t1, 80($fp)
+J L1561
+NOP
+L1560:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1559
+NOP
+L1561:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1562
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1563
+NOP
+L1562:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1564
+NOP
+L1563:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1564:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1565
+NOP
+SW $t1, 24($fp)
+J L1566
+NOP
+L1565:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1564
+NOP
+L1566:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1567
+NOP
+L1567:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f58_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1568
+NOP
+L1568:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1569
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1570
+NOP
+L1569:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1571
+NOP
+L1570:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1571:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1572
+NOP
+SW $t1, 248($fp)
+J L1573
+NOP
+L1572:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1571
+NOP
+L1573:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1574
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1575
+NOP
+L1574:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1576
+NOP
+L1575:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1576:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1577
+NOP
+SW $t1, 192($fp)
+J L1578
+NOP
+L1577:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1576
+NOP
+L1578:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1579
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1580
+NOP
+L1579:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1581
+NOP
+L1580:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1581:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1582
+NOP
+SW $t1, 136($fp)
+J L1583
+NOP
+L1582:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1581
+NOP
+L1583:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1584
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1585
+NOP
+L1584:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1586
+NOP
+L1585:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1586:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1587
+NOP
+SW $t1, 80($fp)
+J L1588
+NOP
+L1587:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1586
+NOP
+L1588:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1589
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1590
+NOP
+L1589:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1591
+NOP
+L1590:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1591:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1592
+NOP
+SW $t1, 24($fp)
+J L1593
+NOP
+L1592:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1591
+NOP
+L1593:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1594
+NOP
+L1594:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f59_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1595
+NOP
+L1595:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1596
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1597
+NOP
+L1596:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1598
+NOP
+L1597:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1598:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1599
+NOP
+SW $t1, 248($fp)
+J L1600
+NOP
+L1599:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1598
+NOP
+L1600:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1601
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1602
+NOP
+L1601:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1603
+NOP
+L1602:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1603:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1604
+NOP
+SW $t1, 192($fp)
+J L1605
+NOP
+L1604:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1603
+NOP
+L1605:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1606
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1607
+NOP
+L1606:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1608
+NOP
+L1607:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1608:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1609
+NOP
+SW $t1, 136($fp)
+J L1610
+NOP
+L1609:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1608
+NOP
+L1610:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1611
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1612
+NOP
+L1611:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1613
+NOP
+L1612:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1613:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1614
+NOP
+SW $t1, 80($fp)
+J L1615
+NOP
+L1614:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1613
+NOP
+L1615:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1616
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1617
+NOP
+L1616:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1618
+NOP
+L1617:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1618:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1619
+NOP
+SW $t1, 24($fp)
+J L1620
+NOP
+L1619:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1618
+NOP
+L1620:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1621
+NOP
+L1621:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f60_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1622
+NOP
+L1622:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1623
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1624
+NOP
+L1623:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1625
+NOP
+L1624:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1625:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1626
+NOP
+SW $t1, 248($fp)
+J L1627
+NOP
+L1626:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1625
+NOP
+L1627:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1628
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1629
+NOP
+L1628:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1630
+NOP
+L1629:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1630:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1631
+NOP
+SW $t1, 192($fp)
+J L1632
+NOP
+L1631:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1630
+NOP
+L1632:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1633
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1634
+NOP
+L1633:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1635
+NOP
+L1634:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1635:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1636
+NOP
+SW $t1, 136($fp)
+J L1637
+NOP
+L1636:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1635
+NOP
+L1637:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1638
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1639
+NOP
+L1638:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1640
+NOP
+L1639:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1640:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1641
+NOP
+SW $t1, 80($fp)
+J L1642
+NOP
+L1641:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1640
+NOP
+L1642:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1643
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1644
+NOP
+L1643:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1645
+NOP
+L1644:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1645:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1646
+NOP
+SW $t1, 24($fp)
+J L1647
+NOP
+L1646:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1645
+NOP
+L1647:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1648
+NOP
+L1648:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f61_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1649
+NOP
+L1649:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1650
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1651
+NOP
+L1650:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1652
+NOP
+L1651:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1652:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1653
+NOP
+SW $t1, 248($fp)
+J L1654
+NOP
+L1653:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1652
+NOP
+L1654:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1655
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1656
+NOP
+L1655:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1657
+NOP
+L1656:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1657:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1658
+NOP
+SW $t1, 192($fp)
+J L1659
+NOP
+L1658:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1657
+NOP
+L1659:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1660
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1661
+NOP
+L1660:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1662
+NOP
+L1661:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1662:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1663
+NOP
+SW $t1, 136($fp)
+J L1664
+NOP
+L1663:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1662
+NOP
+L1664:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1665
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1666
+NOP
+L1665:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1667
+NOP
+L1666:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1667:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1668
+NOP
+SW $t1, 80($fp)
+J L1669
+NOP
+L1668:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1667
+NOP
+L1669:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1670
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1671
+NOP
+L1670:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1672
+NOP
+L1671:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1672:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1673
+NOP
+SW $t1, 24($fp)
+J L1674
+NOP
+L1673:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1672
+NOP
+L1674:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1675
+NOP
+L1675:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f62_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1676
+NOP
+L1676:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1677
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1678
+NOP
+L1677:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1679
+NOP
+L1678:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1679:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1680
+NOP
+SW $t1, 248($fp)
+J L1681
+NOP
+L1680:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1679
+NOP
+L1681:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1682
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1683
+NOP
+L1682:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1684
+NOP
+L1683:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1684:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1685
+NOP
+SW $t1, 192($fp)
+J L1686
+NOP
+L1685:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1684
+NOP
+L1686:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1687
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1688
+NOP
+L1687:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1689
+NOP
+L1688:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1689:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1690
+NOP
+SW $t1, 136($fp)
+J L1691
+NOP
+L1690:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1689
+NOP
+L1691:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1692
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1693
+NOP
+L1692:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1694
+NOP
+L1693:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1694:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1695
+NOP
+SW $t1, 80($fp)
+J L1696
+NOP
+L1695:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1694
+NOP
+L1696:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1697
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1698
+NOP
+L1697:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1699
+NOP
+L1698:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1699:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1700
+NOP
+SW $t1, 24($fp)
+J L1701
+NOP
+L1700:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1699
+NOP
+L1701:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1702
+NOP
+L1702:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f63_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1703
+NOP
+L1703:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1704
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1705
+NOP
+L1704:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1706
+NOP
+L1705:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1706:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1707
+NOP
+SW $t1, 248($fp)
+J L1708
+NOP
+L1707:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1706
+NOP
+L1708:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1709
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1710
+NOP
+L1709:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1711
+NOP
+L1710:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1711:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1712
+NOP
+SW $t1, 192($fp)
+J L1713
+NOP
+L1712:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1711
+NOP
+L1713:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1714
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1715
+NOP
+L1714:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1716
+NOP
+L1715:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1716:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1717
+NOP
+SW $t1, 136($fp)
+J L1718
+NOP
+L1717:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1716
+NOP
+L1718:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1719
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1720
+NOP
+L1719:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1721
+NOP
+L1720:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1721:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1722
+NOP
+SW $t1, 80($fp)
+J L1723
+NOP
+L1722:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1721
+NOP
+L1723:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1724
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1725
+NOP
+L1724:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1726
+NOP
+L1725:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1726:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1727
+NOP
+SW $t1, 24($fp)
+J L1728
+NOP
+L1727:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1726
+NOP
+L1728:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1729
+NOP
+L1729:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f64_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1730
+NOP
+L1730:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1731
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1732
+NOP
+L1731:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1733
+NOP
+L1732:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1733:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1734
+NOP
+SW $t1, 248($fp)
+J L1735
+NOP
+L1734:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1733
+NOP
+L1735:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1736
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1737
+NOP
+L1736:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1738
+NOP
+L1737:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1738:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1739
+NOP
+SW $t1, 192($fp)
+J L1740
+NOP
+L1739:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1738
+NOP
+L1740:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1741
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1742
+NOP
+L1741:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1743
+NOP
+L1742:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1743:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1744
+NOP
+SW $t1, 136($fp)
+J L1745
+NOP
+L1744:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1743
+NOP
+L1745:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1746
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1747
+NOP
+L1746:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1748
+NOP
+L1747:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1748:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1749
+NOP
+SW $t1, 80($fp)
+J L1750
+NOP
+L1749:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1748
+NOP
+L1750:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1751
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1752
+NOP
+L1751:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1753
+NOP
+L1752:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1753:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1754
+NOP
+SW $t1, 24($fp)
+J L1755
+NOP
+L1754:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1753
+NOP
+L1755:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1756
+NOP
+L1756:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f65_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1757
+NOP
+L1757:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1758
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1759
+NOP
+L1758:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1760
+NOP
+L1759:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1760:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1761
+NOP
+SW $t1, 248($fp)
+J L1762
+NOP
+L1761:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1760
+NOP
+L1762:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1763
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1764
+NOP
+L1763:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1765
+NOP
+L1764:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1765:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1766
+NOP
+SW $t1, 192($fp)
+J L1767
+NOP
+L1766:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1765
+NOP
+L1767:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1768
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1769
+NOP
+L1768:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1770
+NOP
+L1769:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1770:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1771
+NOP
+SW $t1, 136($fp)
+J L1772
+NOP
+L1771:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1770
+NOP
+L1772:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1773
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1774
+NOP
+L1773:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1775
+NOP
+L1774:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1775:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1776
+NOP
+SW $t1, 80($fp)
+J L1777
+NOP
+L1776:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1775
+NOP
+L1777:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1778
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1779
+NOP
+L1778:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1780
+NOP
+L1779:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1780:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1781
+NOP
+SW $t1, 24($fp)
+J L1782
+NOP
+L1781:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1780
+NOP
+L1782:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1783
+NOP
+L1783:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f66_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1784
+NOP
+L1784:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1785
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1786
+NOP
+L1785:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1787
+NOP
+L1786:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1787:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1788
+NOP
+SW $t1, 248($fp)
+J L1789
+NOP
+L1788:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1787
+NOP
+L1789:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1790
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1791
+NOP
+L1790:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1792
+NOP
+L1791:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1792:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1793
+NOP
+SW $t1, 192($fp)
+J L1794
+NOP
+L1793:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1792
+NOP
+L1794:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1795
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1796
+NOP
+L1795:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1797
+NOP
+L1796:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1797:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1798
+NOP
+SW $t1, 136($fp)
+J L1799
+NOP
+L1798:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1797
+NOP
+L1799:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1800
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1801
+NOP
+L1800:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1802
+NOP
+L1801:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1802:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1803
+NOP
+SW $t1, 80($fp)
+J L1804
+NOP
+L1803:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1802
+NOP
+L1804:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1805
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1806
+NOP
+L1805:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1807
+NOP
+L1806:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1807:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1808
+NOP
+SW $t1, 24($fp)
+J L1809
+NOP
+L1808:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1807
+NOP
+L1809:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1810
+NOP
+L1810:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f67_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1811
+NOP
+L1811:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1812
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1813
+NOP
+L1812:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1814
+NOP
+L1813:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1814:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1815
+NOP
+SW $t1, 248($fp)
+J L1816
+NOP
+L1815:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1814
+NOP
+L1816:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1817
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1818
+NOP
+L1817:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1819
+NOP
+L1818:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1819:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1820
+NOP
+SW $t1, 192($fp)
+J L1821
+NOP
+L1820:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1819
+NOP
+L1821:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1822
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1823
+NOP
+L1822:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1824
+NOP
+L1823:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1824:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1825
+NOP
+SW $t1, 136($fp)
+J L1826
+NOP
+L1825:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1824
+NOP
+L1826:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1827
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1828
+NOP
+L1827:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1829
+NOP
+L1828:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1829:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1830
+NOP
+SW $t1, 80($fp)
+J L1831
+NOP
+L1830:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1829
+NOP
+L1831:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1832
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1833
+NOP
+L1832:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1834
+NOP
+L1833:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1834:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1835
+NOP
+SW $t1, 24($fp)
+J L1836
+NOP
+L1835:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1834
+NOP
+L1836:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1837
+NOP
+L1837:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f68_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1838
+NOP
+L1838:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1839
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1840
+NOP
+L1839:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1841
+NOP
+L1840:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1841:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1842
+NOP
+SW $t1, 248($fp)
+J L1843
+NOP
+L1842:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1841
+NOP
+L1843:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1844
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1845
+NOP
+L1844:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1846
+NOP
+L1845:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1846:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1847
+NOP
+SW $t1, 192($fp)
+J L1848
+NOP
+L1847:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1846
+NOP
+L1848:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1849
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1850
+NOP
+L1849:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1851
+NOP
+L1850:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1851:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1852
+NOP
+SW $t1, 136($fp)
+J L1853
+NOP
+L1852:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1851
+NOP
+L1853:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1854
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1855
+NOP
+L1854:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1856
+NOP
+L1855:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1856:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1857
+NOP
+SW $t1, 80($fp)
+J L1858
+NOP
+L1857:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1856
+NOP
+L1858:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1859
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1860
+NOP
+L1859:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1861
+NOP
+L1860:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1861:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1862
+NOP
+SW $t1, 24($fp)
+J L1863
+NOP
+L1862:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1861
+NOP
+L1863:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1864
+NOP
+L1864:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f69_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1865
+NOP
+L1865:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1866
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1867
+NOP
+L1866:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1868
+NOP
+L1867:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1868:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1869
+NOP
+SW $t1, 248($fp)
+J L1870
+NOP
+L1869:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1868
+NOP
+L1870:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1871
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1872
+NOP
+L1871:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1873
+NOP
+L1872:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1873:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1874
+NOP
+SW $t1, 192($fp)
+J L1875
+NOP
+L1874:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1873
+NOP
+L1875:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1876
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1877
+NOP
+L1876:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1878
+NOP
+L1877:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1878:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1879
+NOP
+SW $t1, 136($fp)
+J L1880
+NOP
+L1879:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1878
+NOP
+L1880:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1881
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1882
+NOP
+L1881:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1883
+NOP
+L1882:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1883:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1884
+NOP
+SW $t1, 80($fp)
+J L1885
+NOP
+L1884:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1883
+NOP
+L1885:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1886
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1887
+NOP
+L1886:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1888
+NOP
+L1887:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1888:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1889
+NOP
+SW $t1, 24($fp)
+J L1890
+NOP
+L1889:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1888
+NOP
+L1890:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1891
+NOP
+L1891:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f70_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1892
+NOP
+L1892:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1893
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1894
+NOP
+L1893:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1895
+NOP
+L1894:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1895:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1896
+NOP
+SW $t1, 248($fp)
+J L1897
+NOP
+L1896:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1895
+NOP
+L1897:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1898
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1899
+NOP
+L1898:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1900
+NOP
+L1899:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1900:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1901
+NOP
+SW $t1, 192($fp)
+J L1902
+NOP
+L1901:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1900
+NOP
+L1902:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1903
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1904
+NOP
+L1903:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1905
+NOP
+L1904:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1905:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1906
+NOP
+SW $t1, 136($fp)
+J L1907
+NOP
+L1906:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1905
+NOP
+L1907:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1908
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1909
+NOP
+L1908:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1910
+NOP
+L1909:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1910:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1911
+NOP
+SW $t1, 80($fp)
+J L1912
+NOP
+L1911:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1910
+NOP
+L1912:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1913
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1914
+NOP
+L1913:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1915
+NOP
+L1914:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1915:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1916
+NOP
+SW $t1, 24($fp)
+J L1917
+NOP
+L1916:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1915
+NOP
+L1917:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1918
+NOP
+L1918:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f71_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1919
+NOP
+L1919:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1920
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1921
+NOP
+L1920:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1922
+NOP
+L1921:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1922:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1923
+NOP
+SW $t1, 248($fp)
+J L1924
+NOP
+L1923:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1922
+NOP
+L1924:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1925
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1926
+NOP
+L1925:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1927
+NOP
+L1926:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1927:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1928
+NOP
+SW $t1, 192($fp)
+J L1929
+NOP
+L1928:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1927
+NOP
+L1929:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1930
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1931
+NOP
+L1930:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1932
+NOP
+L1931:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1932:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1933
+NOP
+SW $t1, 136($fp)
+J L1934
+NOP
+L1933:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1932
+NOP
+L1934:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1935
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1936
+NOP
+L1935:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1937
+NOP
+L1936:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1937:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1938
+NOP
+SW $t1, 80($fp)
+J L1939
+NOP
+L1938:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1937
+NOP
+L1939:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1940
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1941
+NOP
+L1940:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1942
+NOP
+L1941:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1942:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1943
+NOP
+SW $t1, 24($fp)
+J L1944
+NOP
+L1943:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1942
+NOP
+L1944:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1945
+NOP
+L1945:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f72_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1946
+NOP
+L1946:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1947
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1948
+NOP
+L1947:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1949
+NOP
+L1948:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1949:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1950
+NOP
+SW $t1, 248($fp)
+J L1951
+NOP
+L1950:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1949
+NOP
+L1951:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1952
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1953
+NOP
+L1952:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1954
+NOP
+L1953:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1954:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1955
+NOP
+SW $t1, 192($fp)
+J L1956
+NOP
+L1955:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1954
+NOP
+L1956:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1957
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1958
+NOP
+L1957:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1959
+NOP
+L1958:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1959:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1960
+NOP
+SW $t1, 136($fp)
+J L1961
+NOP
+L1960:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1959
+NOP
+L1961:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1962
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1963
+NOP
+L1962:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1964
+NOP
+L1963:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1964:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1965
+NOP
+SW $t1, 80($fp)
+J L1966
+NOP
+L1965:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1964
+NOP
+L1966:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1967
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1968
+NOP
+L1967:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1969
+NOP
+L1968:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1969:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1970
+NOP
+SW $t1, 24($fp)
+J L1971
+NOP
+L1970:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1969
+NOP
+L1971:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1972
+NOP
+L1972:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f73_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L1973
+NOP
+L1973:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1974
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1975
+NOP
+L1974:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1976
+NOP
+L1975:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1976:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1977
+NOP
+SW $t1, 248($fp)
+J L1978
+NOP
+L1977:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1976
+NOP
+L1978:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1979
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1980
+NOP
+L1979:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1981
+NOP
+L1980:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1981:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1982
+NOP
+SW $t1, 192($fp)
+J L1983
+NOP
+L1982:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1981
+NOP
+L1983:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1984
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1985
+NOP
+L1984:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1986
+NOP
+L1985:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1986:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1987
+NOP
+SW $t1, 136($fp)
+J L1988
+NOP
+L1987:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1986
+NOP
+L1988:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1989
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1990
+NOP
+L1989:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1991
+NOP
+L1990:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1991:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1992
+NOP
+SW $t1, 80($fp)
+J L1993
+NOP
+L1992:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1991
+NOP
+L1993:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1994
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1995
+NOP
+L1994:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1996
+NOP
+L1995:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1996:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1997
+NOP
+SW $t1, 24($fp)
+J L1998
+NOP
+L1997:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1996
+NOP
+L1998:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1999
+NOP
+L1999:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f74_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2000
+NOP
+L2000:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2001
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2002
+NOP
+L2001:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2003
+NOP
+L2002:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2003:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2004
+NOP
+SW $t1, 248($fp)
+J L2005
+NOP
+L2004:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2003
+NOP
+L2005:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2006
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2007
+NOP
+L2006:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2008
+NOP
+L2007:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2008:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2009
+NOP
+SW $t1, 192($fp)
+J L2010
+NOP
+L2009:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2008
+NOP
+L2010:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2011
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2012
+NOP
+L2011:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2013
+NOP
+L2012:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2013:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2014
+NOP
+SW $t1, 136($fp)
+J L2015
+NOP
+L2014:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2013
+NOP
+L2015:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2016
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2017
+NOP
+L2016:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2018
+NOP
+L2017:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2018:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2019
+NOP
+SW $t1, 80($fp)
+J L2020
+NOP
+L2019:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2018
+NOP
+L2020:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2021
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2022
+NOP
+L2021:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2023
+NOP
+L2022:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2023:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2024
+NOP
+SW $t1, 24($fp)
+J L2025
+NOP
+L2024:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2023
+NOP
+L2025:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2026
+NOP
+L2026:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f75_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2027
+NOP
+L2027:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2028
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2029
+NOP
+L2028:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2030
+NOP
+L2029:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2030:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2031
+NOP
+SW $t1, 248($fp)
+J L2032
+NOP
+L2031:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2030
+NOP
+L2032:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2033
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2034
+NOP
+L2033:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2035
+NOP
+L2034:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2035:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2036
+NOP
+SW $t1, 192($fp)
+J L2037
+NOP
+L2036:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2035
+NOP
+L2037:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2038
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2039
+NOP
+L2038:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2040
+NOP
+L2039:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2040:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2041
+NOP
+SW $t1, 136($fp)
+J L2042
+NOP
+L2041:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2040
+NOP
+L2042:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2043
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2044
+NOP
+L2043:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2045
+NOP
+L2044:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2045:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2046
+NOP
+SW $t1, 80($fp)
+J L2047
+NOP
+L2046:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2045
+NOP
+L2047:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2048
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2049
+NOP
+L2048:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2050
+NOP
+L2049:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2050:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2051
+NOP
+SW $t1, 24($fp)
+J L2052
+NOP
+L2051:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2050
+NOP
+L2052:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2053
+NOP
+L2053:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f76_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2054
+NOP
+L2054:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2055
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2056
+NOP
+L2055:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2057
+NOP
+L2056:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2057:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2058
+NOP
+SW $t1, 248($fp)
+J L2059
+NOP
+L2058:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2057
+NOP
+L2059:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2060
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2061
+NOP
+L2060:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2062
+NOP
+L2061:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2062:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2063
+NOP
+SW $t1, 192($fp)
+J L2064
+NOP
+L2063:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2062
+NOP
+L2064:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2065
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2066
+NOP
+L2065:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2067
+NOP
+L2066:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2067:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2068
+NOP
+SW $t1, 136($fp)
+J L2069
+NOP
+L2068:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2067
+NOP
+L2069:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2070
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2071
+NOP
+L2070:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2072
+NOP
+L2071:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2072:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2073
+NOP
+SW $t1, 80($fp)
+J L2074
+NOP
+L2073:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2072
+NOP
+L2074:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2075
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2076
+NOP
+L2075:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2077
+NOP
+L2076:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2077:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2078
+NOP
+SW $t1, 24($fp)
+J L2079
+NOP
+L2078:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2077
+NOP
+L2079:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2080
+NOP
+L2080:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f77_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2081
+NOP
+L2081:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2082
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2083
+NOP
+L2082:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2084
+NOP
+L2083:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2084:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2085
+NOP
+SW $t1, 248($fp)
+J L2086
+NOP
+L2085:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2084
+NOP
+L2086:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2087
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2088
+NOP
+L2087:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2089
+NOP
+L2088:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2089:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2090
+NOP
+SW $t1, 192($fp)
+J L2091
+NOP
+L2090:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2089
+NOP
+L2091:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2092
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2093
+NOP
+L2092:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2094
+NOP
+L2093:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2094:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2095
+NOP
+SW $t1, 136($fp)
+J L2096
+NOP
+L2095:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2094
+NOP
+L2096:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2097
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2098
+NOP
+L2097:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2099
+NOP
+L2098:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2099:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2100
+NOP
+SW $t1, 80($fp)
+J L2101
+NOP
+L2100:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2099
+NOP
+L2101:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2102
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2103
+NOP
+L2102:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2104
+NOP
+L2103:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2104:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2105
+NOP
+SW $t1, 24($fp)
+J L2106
+NOP
+L2105:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2104
+NOP
+L2106:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2107
+NOP
+L2107:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f78_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2108
+NOP
+L2108:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2109
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2110
+NOP
+L2109:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2111
+NOP
+L2110:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2111:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2112
+NOP
+SW $t1, 248($fp)
+J L2113
+NOP
+L2112:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2111
+NOP
+L2113:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2114
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2115
+NOP
+L2114:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2116
+NOP
+L2115:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2116:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2117
+NOP
+SW $t1, 192($fp)
+J L2118
+NOP
+L2117:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2116
+NOP
+L2118:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2119
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2120
+NOP
+L2119:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2121
+NOP
+L2120:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2121:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2122
+NOP
+SW $t1, 136($fp)
+J L2123
+NOP
+L2122:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2121
+NOP
+L2123:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2124
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2125
+NOP
+L2124:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2126
+NOP
+L2125:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2126:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2127
+NOP
+SW $t1, 80($fp)
+J L2128
+NOP
+L2127:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2126
+NOP
+L2128:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2129
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2130
+NOP
+L2129:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2131
+NOP
+L2130:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2131:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2132
+NOP
+SW $t1, 24($fp)
+J L2133
+NOP
+L2132:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2131
+NOP
+L2133:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2134
+NOP
+L2134:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f79_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2135
+NOP
+L2135:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2136
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2137
+NOP
+L2136:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2138
+NOP
+L2137:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2138:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2139
+NOP
+SW $t1, 248($fp)
+J L2140
+NOP
+L2139:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2138
+NOP
+L2140:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2141
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2142
+NOP
+L2141:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2143
+NOP
+L2142:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2143:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2144
+NOP
+SW $t1, 192($fp)
+J L2145
+NOP
+L2144:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2143
+NOP
+L2145:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2146
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2147
+NOP
+L2146:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2148
+NOP
+L2147:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2148:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2149
+NOP
+SW $t1, 136($fp)
+J L2150
+NOP
+L2149:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2148
+NOP
+L2150:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2151
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2152
+NOP
+L2151:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2153
+NOP
+L2152:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2153:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2154
+NOP
+SW $t1, 80($fp)
+J L2155
+NOP
+L2154:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2153
+NOP
+L2155:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2156
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2157
+NOP
+L2156:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2158
+NOP
+L2157:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2158:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2159
+NOP
+SW $t1, 24($fp)
+J L2160
+NOP
+L2159:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2158
+NOP
+L2160:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2161
+NOP
+L2161:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f80_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2162
+NOP
+L2162:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2163
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2164
+NOP
+L2163:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2165
+NOP
+L2164:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2165:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2166
+NOP
+SW $t1, 248($fp)
+J L2167
+NOP
+L2166:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2165
+NOP
+L2167:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2168
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2169
+NOP
+L2168:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2170
+NOP
+L2169:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2170:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2171
+NOP
+SW $t1, 192($fp)
+J L2172
+NOP
+L2171:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2170
+NOP
+L2172:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2173
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2174
+NOP
+L2173:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2175
+NOP
+L2174:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2175:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2176
+NOP
+SW $t1, 136($fp)
+J L2177
+NOP
+L2176:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2175
+NOP
+L2177:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2178
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2179
+NOP
+L2178:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2180
+NOP
+L2179:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2180:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2181
+NOP
+SW $t1, 80($fp)
+J L2182
+NOP
+L2181:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2180
+NOP
+L2182:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2183
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2184
+NOP
+L2183:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2185
+NOP
+L2184:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2185:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2186
+NOP
+SW $t1, 24($fp)
+J L2187
+NOP
+L2186:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2185
+NOP
+L2187:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2188
+NOP
+L2188:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f81_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2189
+NOP
+L2189:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2190
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2191
+NOP
+L2190:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2192
+NOP
+L2191:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2192:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2193
+NOP
+SW $t1, 248($fp)
+J L2194
+NOP
+L2193:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2192
+NOP
+L2194:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2195
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2196
+NOP
+L2195:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2197
+NOP
+L2196:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2197:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2198
+NOP
+SW $t1, 192($fp)
+J L2199
+NOP
+L2198:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2197
+NOP
+L2199:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2200
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2201
+NOP
+L2200:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2202
+NOP
+L2201:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2202:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2203
+NOP
+SW $t1, 136($fp)
+J L2204
+NOP
+L2203:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2202
+NOP
+L2204:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2205
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2206
+NOP
+L2205:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2207
+NOP
+L2206:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2207:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2208
+NOP
+SW $t1, 80($fp)
+J L2209
+NOP
+L2208:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2207
+NOP
+L2209:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2210
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2211
+NOP
+L2210:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2212
+NOP
+L2211:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2212:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2213
+NOP
+SW $t1, 24($fp)
+J L2214
+NOP
+L2213:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2212
+NOP
+L2214:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2215
+NOP
+L2215:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f82_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2216
+NOP
+L2216:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2217
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2218
+NOP
+L2217:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2219
+NOP
+L2218:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2219:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2220
+NOP
+SW $t1, 248($fp)
+J L2221
+NOP
+L2220:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2219
+NOP
+L2221:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2222
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2223
+NOP
+L2222:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2224
+NOP
+L2223:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2224:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2225
+NOP
+SW $t1, 192($fp)
+J L2226
+NOP
+L2225:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2224
+NOP
+L2226:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2227
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2228
+NOP
+L2227:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2229
+NOP
+L2228:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2229:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2230
+NOP
+SW $t1, 136($fp)
+J L2231
+NOP
+L2230:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2229
+NOP
+L2231:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2232
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2233
+NOP
+L2232:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2234
+NOP
+L2233:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2234:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2235
+NOP
+SW $t1, 80($fp)
+J L2236
+NOP
+L2235:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2234
+NOP
+L2236:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2237
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2238
+NOP
+L2237:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2239
+NOP
+L2238:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2239:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2240
+NOP
+SW $t1, 24($fp)
+J L2241
+NOP
+L2240:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2239
+NOP
+L2241:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2242
+NOP
+L2242:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f83_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2243
+NOP
+L2243:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2244
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2245
+NOP
+L2244:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2246
+NOP
+L2245:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2246:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2247
+NOP
+SW $t1, 248($fp)
+J L2248
+NOP
+L2247:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2246
+NOP
+L2248:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2249
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2250
+NOP
+L2249:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2251
+NOP
+L2250:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2251:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2252
+NOP
+SW $t1, 192($fp)
+J L2253
+NOP
+L2252:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2251
+NOP
+L2253:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2254
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2255
+NOP
+L2254:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2256
+NOP
+L2255:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2256:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2257
+NOP
+SW $t1, 136($fp)
+J L2258
+NOP
+L2257:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2256
+NOP
+L2258:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2259
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2260
+NOP
+L2259:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2261
+NOP
+L2260:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2261:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2262
+NOP
+SW $t1, 80($fp)
+J L2263
+NOP
+L2262:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2261
+NOP
+L2263:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2264
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2265
+NOP
+L2264:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2266
+NOP
+L2265:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2266:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2267
+NOP
+SW $t1, 24($fp)
+J L2268
+NOP
+L2267:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2266
+NOP
+L2268:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2269
+NOP
+L2269:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f84_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2270
+NOP
+L2270:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2271
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2272
+NOP
+L2271:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2273
+NOP
+L2272:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2273:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2274
+NOP
+SW $t1, 248($fp)
+J L2275
+NOP
+L2274:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2273
+NOP
+L2275:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2276
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2277
+NOP
+L2276:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2278
+NOP
+L2277:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2278:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2279
+NOP
+SW $t1, 192($fp)
+J L2280
+NOP
+L2279:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2278
+NOP
+L2280:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2281
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2282
+NOP
+L2281:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2283
+NOP
+L2282:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2283:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2284
+NOP
+SW $t1, 136($fp)
+J L2285
+NOP
+L2284:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2283
+NOP
+L2285:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2286
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2287
+NOP
+L2286:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2288
+NOP
+L2287:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2288:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2289
+NOP
+SW $t1, 80($fp)
+J L2290
+NOP
+L2289:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2288
+NOP
+L2290:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2291
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2292
+NOP
+L2291:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2293
+NOP
+L2292:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2293:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2294
+NOP
+SW $t1, 24($fp)
+J L2295
+NOP
+L2294:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2293
+NOP
+L2295:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2296
+NOP
+L2296:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f85_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2297
+NOP
+L2297:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2298
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2299
+NOP
+L2298:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2300
+NOP
+L2299:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2300:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2301
+NOP
+SW $t1, 248($fp)
+J L2302
+NOP
+L2301:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2300
+NOP
+L2302:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2303
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2304
+NOP
+L2303:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2305
+NOP
+L2304:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2305:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2306
+NOP
+SW $t1, 192($fp)
+J L2307
+NOP
+L2306:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2305
+NOP
+L2307:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2308
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2309
+NOP
+L2308:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2310
+NOP
+L2309:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2310:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2311
+NOP
+SW $t1, 136($fp)
+J L2312
+NOP
+L2311:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2310
+NOP
+L2312:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2313
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2314
+NOP
+L2313:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2315
+NOP
+L2314:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2315:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2316
+NOP
+SW $t1, 80($fp)
+J L2317
+NOP
+L2316:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2315
+NOP
+L2317:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2318
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2319
+NOP
+L2318:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2320
+NOP
+L2319:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2320:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2321
+NOP
+SW $t1, 24($fp)
+J L2322
+NOP
+L2321:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2320
+NOP
+L2322:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2323
+NOP
+L2323:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f86_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2324
+NOP
+L2324:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2325
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2326
+NOP
+L2325:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2327
+NOP
+L2326:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2327:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2328
+NOP
+SW $t1, 248($fp)
+J L2329
+NOP
+L2328:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2327
+NOP
+L2329:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2330
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2331
+NOP
+L2330:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2332
+NOP
+L2331:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2332:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2333
+NOP
+SW $t1, 192($fp)
+J L2334
+NOP
+L2333:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2332
+NOP
+L2334:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2335
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2336
+NOP
+L2335:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2337
+NOP
+L2336:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2337:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2338
+NOP
+SW $t1, 136($fp)
+J L2339
+NOP
+L2338:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2337
+NOP
+L2339:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2340
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2341
+NOP
+L2340:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2342
+NOP
+L2341:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2342:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2343
+NOP
+SW $t1, 80($fp)
+J L2344
+NOP
+L2343:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2342
+NOP
+L2344:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2345
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2346
+NOP
+L2345:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2347
+NOP
+L2346:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2347:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2348
+NOP
+SW $t1, 24($fp)
+J L2349
+NOP
+L2348:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2347
+NOP
+L2349:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2350
+NOP
+L2350:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f87_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2351
+NOP
+L2351:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2352
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2353
+NOP
+L2352:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2354
+NOP
+L2353:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2354:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2355
+NOP
+SW $t1, 248($fp)
+J L2356
+NOP
+L2355:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2354
+NOP
+L2356:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2357
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2358
+NOP
+L2357:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2359
+NOP
+L2358:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2359:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2360
+NOP
+SW $t1, 192($fp)
+J L2361
+NOP
+L2360:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2359
+NOP
+L2361:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2362
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2363
+NOP
+L2362:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2364
+NOP
+L2363:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2364:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2365
+NOP
+SW $t1, 136($fp)
+J L2366
+NOP
+L2365:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2364
+NOP
+L2366:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2367
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2368
+NOP
+L2367:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2369
+NOP
+L2368:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2369:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2370
+NOP
+SW $t1, 80($fp)
+J L2371
+NOP
+L2370:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2369
+NOP
+L2371:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2372
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2373
+NOP
+L2372:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2374
+NOP
+L2373:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2374:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2375
+NOP
+SW $t1, 24($fp)
+J L2376
+NOP
+L2375:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2374
+NOP
+L2376:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2377
+NOP
+L2377:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f88_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2378
+NOP
+L2378:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2379
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2380
+NOP
+L2379:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2381
+NOP
+L2380:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2381:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2382
+NOP
+SW $t1, 248($fp)
+J L2383
+NOP
+L2382:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2381
+NOP
+L2383:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2384
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2385
+NOP
+L2384:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2386
+NOP
+L2385:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2386:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2387
+NOP
+SW $t1, 192($fp)
+J L2388
+NOP
+L2387:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2386
+NOP
+L2388:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2389
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2390
+NOP
+L2389:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2391
+NOP
+L2390:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2391:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2392
+NOP
+SW $t1, 136($fp)
+J L2393
+NOP
+L2392:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2391
+NOP
+L2393:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2394
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2395
+NOP
+L2394:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2396
+NOP
+L2395:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2396:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2397
+NOP
+SW $t1, 80($fp)
+J L2398
+NOP
+L2397:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2396
+NOP
+L2398:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2399
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2400
+NOP
+L2399:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2401
+NOP
+L2400:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2401:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2402
+NOP
+SW $t1, 24($fp)
+J L2403
+NOP
+L2402:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2401
+NOP
+L2403:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2404
+NOP
+L2404:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f89_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2405
+NOP
+L2405:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2406
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2407
+NOP
+L2406:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2408
+NOP
+L2407:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2408:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2409
+NOP
+SW $t1, 248($fp)
+J L2410
+NOP
+L2409:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2408
+NOP
+L2410:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2411
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2412
+NOP
+L2411:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2413
+NOP
+L2412:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2413:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2414
+NOP
+SW $t1, 192($fp)
+J L2415
+NOP
+L2414:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2413
+NOP
+L2415:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2416
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2417
+NOP
+L2416:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2418
+NOP
+L2417:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2418:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2419
+NOP
+SW $t1, 136($fp)
+J L2420
+NOP
+L2419:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2418
+NOP
+L2420:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2421
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2422
+NOP
+L2421:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2423
+NOP
+L2422:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2423:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2424
+NOP
+SW $t1, 80($fp)
+J L2425
+NOP
+L2424:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2423
+NOP
+L2425:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2426
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2427
+NOP
+L2426:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2428
+NOP
+L2427:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2428:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2429
+NOP
+SW $t1, 24($fp)
+J L2430
+NOP
+L2429:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2428
+NOP
+L2430:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2431
+NOP
+L2431:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f90_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2432
+NOP
+L2432:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2433
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2434
+NOP
+L2433:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2435
+NOP
+L2434:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2435:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2436
+NOP
+SW $t1, 248($fp)
+J L2437
+NOP
+L2436:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2435
+NOP
+L2437:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2438
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2439
+NOP
+L2438:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2440
+NOP
+L2439:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2440:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2441
+NOP
+SW $t1, 192($fp)
+J L2442
+NOP
+L2441:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2440
+NOP
+L2442:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2443
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2444
+NOP
+L2443:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2445
+NOP
+L2444:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2445:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2446
+NOP
+SW $t1, 136($fp)
+J L2447
+NOP
+L2446:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2445
+NOP
+L2447:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2448
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2449
+NOP
+L2448:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2450
+NOP
+L2449:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2450:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2451
+NOP
+SW $t1, 80($fp)
+J L2452
+NOP
+L2451:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2450
+NOP
+L2452:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2453
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2454
+NOP
+L2453:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2455
+NOP
+L2454:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2455:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2456
+NOP
+SW $t1, 24($fp)
+J L2457
+NOP
+L2456:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2455
+NOP
+L2457:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2458
+NOP
+L2458:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f91_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2459
+NOP
+L2459:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2460
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2461
+NOP
+L2460:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2462
+NOP
+L2461:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2462:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2463
+NOP
+SW $t1, 248($fp)
+J L2464
+NOP
+L2463:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2462
+NOP
+L2464:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2465
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2466
+NOP
+L2465:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2467
+NOP
+L2466:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2467:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2468
+NOP
+SW $t1, 192($fp)
+J L2469
+NOP
+L2468:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2467
+NOP
+L2469:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2470
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2471
+NOP
+L2470:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2472
+NOP
+L2471:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2472:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2473
+NOP
+SW $t1, 136($fp)
+J L2474
+NOP
+L2473:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2472
+NOP
+L2474:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2475
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2476
+NOP
+L2475:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2477
+NOP
+L2476:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2477:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2478
+NOP
+SW $t1, 80($fp)
+J L2479
+NOP
+L2478:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2477
+NOP
+L2479:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2480
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2481
+NOP
+L2480:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2482
+NOP
+L2481:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2482:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2483
+NOP
+SW $t1, 24($fp)
+J L2484
+NOP
+L2483:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2482
+NOP
+L2484:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2485
+NOP
+L2485:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f92_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2486
+NOP
+L2486:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2487
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2488
+NOP
+L2487:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2489
+NOP
+L2488:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2489:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2490
+NOP
+SW $t1, 248($fp)
+J L2491
+NOP
+L2490:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2489
+NOP
+L2491:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2492
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2493
+NOP
+L2492:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2494
+NOP
+L2493:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2494:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2495
+NOP
+SW $t1, 192($fp)
+J L2496
+NOP
+L2495:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2494
+NOP
+L2496:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2497
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2498
+NOP
+L2497:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2499
+NOP
+L2498:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2499:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2500
+NOP
+SW $t1, 136($fp)
+J L2501
+NOP
+L2500:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2499
+NOP
+L2501:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2502
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2503
+NOP
+L2502:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2504
+NOP
+L2503:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2504:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2505
+NOP
+SW $t1, 80($fp)
+J L2506
+NOP
+L2505:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2504
+NOP
+L2506:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2507
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2508
+NOP
+L2507:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2509
+NOP
+L2508:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2509:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2510
+NOP
+SW $t1, 24($fp)
+J L2511
+NOP
+L2510:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2509
+NOP
+L2511:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2512
+NOP
+L2512:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f93_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2513
+NOP
+L2513:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2514
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2515
+NOP
+L2514:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2516
+NOP
+L2515:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2516:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2517
+NOP
+SW $t1, 248($fp)
+J L2518
+NOP
+L2517:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2516
+NOP
+L2518:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2519
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2520
+NOP
+L2519:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2521
+NOP
+L2520:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2521:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2522
+NOP
+SW $t1, 192($fp)
+J L2523
+NOP
+L2522:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2521
+NOP
+L2523:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2524
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2525
+NOP
+L2524:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2526
+NOP
+L2525:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2526:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2527
+NOP
+SW $t1, 136($fp)
+J L2528
+NOP
+L2527:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2526
+NOP
+L2528:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2529
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2530
+NOP
+L2529:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2531
+NOP
+L2530:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2531:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2532
+NOP
+SW $t1, 80($fp)
+J L2533
+NOP
+L2532:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2531
+NOP
+L2533:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2534
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2535
+NOP
+L2534:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2536
+NOP
+L2535:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2536:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2537
+NOP
+SW $t1, 24($fp)
+J L2538
+NOP
+L2537:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2536
+NOP
+L2538:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2539
+NOP
+L2539:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f94_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2540
+NOP
+L2540:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2541
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2542
+NOP
+L2541:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2543
+NOP
+L2542:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2543:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2544
+NOP
+SW $t1, 248($fp)
+J L2545
+NOP
+L2544:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2543
+NOP
+L2545:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2546
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2547
+NOP
+L2546:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2548
+NOP
+L2547:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2548:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2549
+NOP
+SW $t1, 192($fp)
+J L2550
+NOP
+L2549:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2548
+NOP
+L2550:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2551
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2552
+NOP
+L2551:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2553
+NOP
+L2552:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2553:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2554
+NOP
+SW $t1, 136($fp)
+J L2555
+NOP
+L2554:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2553
+NOP
+L2555:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2556
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2557
+NOP
+L2556:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2558
+NOP
+L2557:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2558:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2559
+NOP
+SW $t1, 80($fp)
+J L2560
+NOP
+L2559:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2558
+NOP
+L2560:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2561
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2562
+NOP
+L2561:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2563
+NOP
+L2562:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2563:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2564
+NOP
+SW $t1, 24($fp)
+J L2565
+NOP
+L2564:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2563
+NOP
+L2565:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2566
+NOP
+L2566:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f95_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2567
+NOP
+L2567:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2568
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2569
+NOP
+L2568:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2570
+NOP
+L2569:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2570:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2571
+NOP
+SW $t1, 248($fp)
+J L2572
+NOP
+L2571:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2570
+NOP
+L2572:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2573
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2574
+NOP
+L2573:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2575
+NOP
+L2574:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2575:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2576
+NOP
+SW $t1, 192($fp)
+J L2577
+NOP
+L2576:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2575
+NOP
+L2577:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2578
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2579
+NOP
+L2578:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2580
+NOP
+L2579:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2580:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2581
+NOP
+SW $t1, 136($fp)
+J L2582
+NOP
+L2581:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2580
+NOP
+L2582:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2583
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2584
+NOP
+L2583:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2585
+NOP
+L2584:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2585:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2586
+NOP
+SW $t1, 80($fp)
+J L2587
+NOP
+L2586:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2585
+NOP
+L2587:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2588
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2589
+NOP
+L2588:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2590
+NOP
+L2589:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2590:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2591
+NOP
+SW $t1, 24($fp)
+J L2592
+NOP
+L2591:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2590
+NOP
+L2592:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2593
+NOP
+L2593:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f96_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2594
+NOP
+L2594:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2595
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2596
+NOP
+L2595:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2597
+NOP
+L2596:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2597:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2598
+NOP
+SW $t1, 248($fp)
+J L2599
+NOP
+L2598:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2597
+NOP
+L2599:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2600
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2601
+NOP
+L2600:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2602
+NOP
+L2601:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2602:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2603
+NOP
+SW $t1, 192($fp)
+J L2604
+NOP
+L2603:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2602
+NOP
+L2604:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2605
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2606
+NOP
+L2605:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2607
+NOP
+L2606:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2607:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2608
+NOP
+SW $t1, 136($fp)
+J L2609
+NOP
+L2608:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2607
+NOP
+L2609:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2610
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2611
+NOP
+L2610:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2612
+NOP
+L2611:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2612:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2613
+NOP
+SW $t1, 80($fp)
+J L2614
+NOP
+L2613:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2612
+NOP
+L2614:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2615
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2616
+NOP
+L2615:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2617
+NOP
+L2616:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2617:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2618
+NOP
+SW $t1, 24($fp)
+J L2619
+NOP
+L2618:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2617
+NOP
+L2619:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2620
+NOP
+L2620:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f97_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2621
+NOP
+L2621:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2622
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2623
+NOP
+L2622:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2624
+NOP
+L2623:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2624:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2625
+NOP
+SW $t1, 248($fp)
+J L2626
+NOP
+L2625:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2624
+NOP
+L2626:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2627
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2628
+NOP
+L2627:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2629
+NOP
+L2628:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2629:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2630
+NOP
+SW $t1, 192($fp)
+J L2631
+NOP
+L2630:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2629
+NOP
+L2631:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2632
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2633
+NOP
+L2632:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2634
+NOP
+L2633:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2634:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2635
+NOP
+SW $t1, 136($fp)
+J L2636
+NOP
+L2635:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2634
+NOP
+L2636:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2637
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2638
+NOP
+L2637:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2639
+NOP
+L2638:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2639:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2640
+NOP
+SW $t1, 80($fp)
+J L2641
+NOP
+L2640:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2639
+NOP
+L2641:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2642
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2643
+NOP
+L2642:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2644
+NOP
+L2643:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2644:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2645
+NOP
+SW $t1, 24($fp)
+J L2646
+NOP
+L2645:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2644
+NOP
+L2646:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2647
+NOP
+L2647:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f98_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2648
+NOP
+L2648:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2649
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2650
+NOP
+L2649:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2651
+NOP
+L2650:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2651:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2652
+NOP
+SW $t1, 248($fp)
+J L2653
+NOP
+L2652:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2651
+NOP
+L2653:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2654
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2655
+NOP
+L2654:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2656
+NOP
+L2655:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2656:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2657
+NOP
+SW $t1, 192($fp)
+J L2658
+NOP
+L2657:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2656
+NOP
+L2658:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2659
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2660
+NOP
+L2659:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2661
+NOP
+L2660:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2661:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2662
+NOP
+SW $t1, 136($fp)
+J L2663
+NOP
+L2662:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2661
+NOP
+L2663:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2664
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2665
+NOP
+L2664:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2666
+NOP
+L2665:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2666:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2667
+NOP
+SW $t1, 80($fp)
+J L2668
+NOP
+L2667:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2666
+NOP
+L2668:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2669
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2670
+NOP
+L2669:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2671
+NOP
+L2670:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2671:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2672
+NOP
+SW $t1, 24($fp)
+J L2673
+NOP
+L2672:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2671
+NOP
+L2673:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2674
+NOP
+L2674:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f99_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+J L2675
+NOP
+L2675:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2676
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2677
+NOP
+L2676:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2678
+NOP
+L2677:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2678:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2679
+NOP
+SW $t1, 248($fp)
+J L2680
+NOP
+L2679:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2678
+NOP
+L2680:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_3
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2681
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2682
+NOP
+L2681:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2683
+NOP
+L2682:
+LA $t0, immediate_4
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2683:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2684
+NOP
+SW $t1, 192($fp)
+J L2685
+NOP
+L2684:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2683
+NOP
+L2685:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_6
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2686
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2687
+NOP
+L2686:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2688
+NOP
+L2687:
+LA $t0, immediate_7
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2688:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2689
+NOP
+SW $t1, 136($fp)
+J L2690
+NOP
+L2689:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2688
+NOP
+L2690:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_9
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2691
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2692
+NOP
+L2691:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2693
+NOP
+L2692:
+LA $t0, immediate_10
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2693:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2694
+NOP
+SW $t1, 80($fp)
+J L2695
+NOP
+L2694:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2693
+NOP
+L2695:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_12
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2696
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2697
+NOP
+L2696:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2698
+NOP
+L2697:
+LA $t0, immediate_13
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2698:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2699
+NOP
+SW $t1, 24($fp)
+J L2700
+NOP
+L2699:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2698
+NOP
+L2700:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2701
+NOP
+L2701:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_main_S0__sig:
+ADDIU $sp, $sp, -36
+SW $ra, 32($sp)
+SW $fp, 28($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LA $t0, immediate_2
+LW $t2, 0($t0)
+ADDIU $sp, $sp, -4
+SW $t2, 0($sp)
+ADDIU $sp, $sp, -4
+SW $t1, 0($sp)
+SW $t1, 20($fp)
+SW $t2, 24($fp)
+LI $a0, 12
+JAL _f_f0_S0__sig_5_5
+NOP
+ADDIU $sp, $sp, 8
+LW $t1, 20($fp)
+LW $t2, 24($fp)
+MOVE $t0, $v0
+LA $t3, immediate_1
+LW $t4, 0($t3)
+MOVE $v0, $t4
+SW $t0, 8($fp)
+SW $t4, 0($fp)
+J L2702
+NOP
+L2702:
+LW $fp, 28($sp)
+LW $ra, 32($sp)
+ADDIU $sp, $sp, 36
+JR $ra
+
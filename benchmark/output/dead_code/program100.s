@@ -0,0 +1,35162 @@
+.data
+_v_g0_S0: .word 1
+immediate_0: .word 2
+immediate_1: .word 0
+immediate_2: .word 100
+immediate_3: .word 1
+immediate_4: .word 4
+immediate_5: .word 5
+immediate_6: .word 6
+immediate_7: .word 8
+immediate_8: .word 9
+immediate_9: .word 10
+immediate_10: .word 12
+immediate_11: .word 13
+immediate_12: .word 14
+immediate_13: .word 16
+immediate_14: .word 17
+immediate_15: .word 18
+.text
+.global _start
+_start:
+jal _f_main_S0__sig
+li $v0, 10
+syscall
+
+L1:
+_f_f0_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L4:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2
+NOP
+SW $t1, 296($fp)
+J L3
+NOP
+L2:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L4
+NOP
+L3:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L5
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L6
+NOP
+L5:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L7
+NOP
+L6:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L7:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L8
+NOP
+SW $t1, 248($fp)
+J L9
+NOP
+L8:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L7
+NOP
+L9:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L10
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L11
+NOP
+L10:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L12
+NOP
+L11:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L12:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L13
+NOP
+SW $t1, 192($fp)
+J L14
+NOP
+L13:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L12
+NOP
+L14:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L15
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L16
+NOP
+L15:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L17
+NOP
+L16:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L17:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L18
+NOP
+SW $t1, 136($fp)
+J L19
+NOP
+L18:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L17
+NOP
+L19:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L20
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L21
+NOP
+L20:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L22
+NOP
+L21:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L22:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L23
+NOP
+SW $t1, 80($fp)
+J L24
+NOP
+L23:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L22
+NOP
+L24:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L25
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L26
+NOP
+L25:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L27
+NOP
+L26:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L27:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L28
+NOP
+SW $t1, 24($fp)
+J L29
+NOP
+L28:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L27
+NOP
+L29:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L30
+NOP
+L30:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f1_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L33:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L31
+NOP
+SW $t1, 296($fp)
+J L32
+NOP
+L31:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L33
+NOP
+L32:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L34
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L35
+NOP
+L34:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L36
+NOP
+L35:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L36:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L37
+NOP
+SW $t1, 248($fp)
+J L38
+NOP
+L37:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L36
+NOP
+L38:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L39
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L40
+NOP
+L39:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L41
+NOP
+L40:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L41:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L42
+NOP
+SW $t1, 192($fp)
+J L43
+NOP
+L42:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L41
+NOP
+L43:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L44
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L45
+NOP
+L44:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L46
+NOP
+L45:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L46:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L47
+NOP
+SW $t1, 136($fp)
+J L48
+NOP
+L47:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L46
+NOP
+L48:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L49
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L50
+NOP
+L49:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L51
+NOP
+L50:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L51:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L52
+NOP
+SW $t1, 80($fp)
+J L53
+NOP
+L52:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L51
+NOP
+L53:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L54
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L55
+NOP
+L54:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L56
+NOP
+L55:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L56:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L57
+NOP
+SW $t1, 24($fp)
+J L58
+NOP
+L57:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L56
+NOP
+L58:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L59
+NOP
+L59:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f2_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L62:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L60
+NOP
+SW $t1, 296($fp)
+J L61
+NOP
+L60:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L62
+NOP
+L61:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L63
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L64
+NOP
+L63:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L65
+NOP
+L64:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L65:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L66
+NOP
+SW $t1, 248($fp)
+J L67
+NOP
+L66:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L65
+NOP
+L67:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L68
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L69
+NOP
+L68:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L70
+NOP
+L69:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L70:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L71
+NOP
+SW $t1, 192($fp)
+J L72
+NOP
+L71:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L70
+NOP
+L72:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L73
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L74
+NOP
+L73:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L75
+NOP
+L74:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L75:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L76
+NOP
+SW $t1, 136($fp)
+J L77
+NOP
+L76:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L75
+NOP
+L77:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L78
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L79
+NOP
+L78:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L80
+NOP
+L79:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L80:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L81
+NOP
+SW $t1, 80($fp)
+J L82
+NOP
+L81:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L80
+NOP
+L82:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L83
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L84
+NOP
+L83:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L85
+NOP
+L84:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L85:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L86
+NOP
+SW $t1, 24($fp)
+J L87
+NOP
+L86:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L85
+NOP
+L87:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L88
+NOP
+L88:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f3_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L91:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L89
+NOP
+SW $t1, 296($fp)
+J L90
+NOP
+L89:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L91
+NOP
+L90:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L92
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L93
+NOP
+L92:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L94
+NOP
+L93:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L94:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L95
+NOP
+SW $t1, 248($fp)
+J L96
+NOP
+L95:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L94
+NOP
+L96:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L97
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L98
+NOP
+L97:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L99
+NOP
+L98:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L99:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L100
+NOP
+SW $t1, 192($fp)
+J L101
+NOP
+L100:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L99
+NOP
+L101:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L102
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L103
+NOP
+L102:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L104
+NOP
+L103:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L104:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L105
+NOP
+SW $t1, 136($fp)
+J L106
+NOP
+L105:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L104
+NOP
+L106:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L107
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L108
+NOP
+L107:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L109
+NOP
+L108:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L109:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L110
+NOP
+SW $t1, 80($fp)
+J L111
+NOP
+L110:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L109
+NOP
+L111:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L112
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L113
+NOP
+L112:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L114
+NOP
+L113:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L114:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L115
+NOP
+SW $t1, 24($fp)
+J L116
+NOP
+L115:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L114
+NOP
+L116:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L117
+NOP
+L117:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f4_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L120:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L118
+NOP
+SW $t1, 296($fp)
+J L119
+NOP
+L118:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L120
+NOP
+L119:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L121
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L122
+NOP
+L121:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L123
+NOP
+L122:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L123:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L124
+NOP
+SW $t1, 248($fp)
+J L125
+NOP
+L124:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L123
+NOP
+L125:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L126
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L127
+NOP
+L126:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L128
+NOP
+L127:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L128:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L129
+NOP
+SW $t1, 192($fp)
+J L130
+NOP
+L129:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L128
+NOP
+L130:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L131
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L132
+NOP
+L131:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L133
+NOP
+L132:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L133:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L134
+NOP
+SW $t1, 136($fp)
+J L135
+NOP
+L134:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L133
+NOP
+L135:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L136
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L137
+NOP
+L136:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L138
+NOP
+L137:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L138:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L139
+NOP
+SW $t1, 80($fp)
+J L140
+NOP
+L139:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L138
+NOP
+L140:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L141
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L142
+NOP
+L141:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L143
+NOP
+L142:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L143:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L144
+NOP
+SW $t1, 24($fp)
+J L145
+NOP
+L144:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L143
+NOP
+L145:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L146
+NOP
+L146:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f5_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L149:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L147
+NOP
+SW $t1, 296($fp)
+J L148
+NOP
+L147:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L149
+NOP
+L148:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L150
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L151
+NOP
+L150:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L152
+NOP
+L151:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L152:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L153
+NOP
+SW $t1, 248($fp)
+J L154
+NOP
+L153:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L152
+NOP
+L154:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L155
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L156
+NOP
+L155:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L157
+NOP
+L156:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L157:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L158
+NOP
+SW $t1, 192($fp)
+J L159
+NOP
+L158:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L157
+NOP
+L159:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L160
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L161
+NOP
+L160:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L162
+NOP
+L161:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L162:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L163
+NOP
+SW $t1, 136($fp)
+J L164
+NOP
+L163:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L162
+NOP
+L164:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L165
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L166
+NOP
+L165:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L167
+NOP
+L166:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L167:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L168
+NOP
+SW $t1, 80($fp)
+J L169
+NOP
+L168:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L167
+NOP
+L169:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L170
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L171
+NOP
+L170:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L172
+NOP
+L171:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L172:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L173
+NOP
+SW $t1, 24($fp)
+J L174
+NOP
+L173:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L172
+NOP
+L174:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L175
+NOP
+L175:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f6_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L178:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L176
+NOP
+SW $t1, 296($fp)
+J L177
+NOP
+L176:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L178
+NOP
+L177:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L179
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L180
+NOP
+L179:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L181
+NOP
+L180:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L181:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L182
+NOP
+SW $t1, 248($fp)
+J L183
+NOP
+L182:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L181
+NOP
+L183:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L184
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L185
+NOP
+L184:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L186
+NOP
+L185:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L186:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L187
+NOP
+SW $t1, 192($fp)
+J L188
+NOP
+L187:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L186
+NOP
+L188:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L189
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L190
+NOP
+L189:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L191
+NOP
+L190:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L191:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L192
+NOP
+SW $t1, 136($fp)
+J L193
+NOP
+L192:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L191
+NOP
+L193:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L194
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L195
+NOP
+L194:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L196
+NOP
+L195:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L196:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L197
+NOP
+SW $t1, 80($fp)
+J L198
+NOP
+L197:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L196
+NOP
+L198:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L199
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L200
+NOP
+L199:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L201
+NOP
+L200:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L201:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L202
+NOP
+SW $t1, 24($fp)
+J L203
+NOP
+L202:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L201
+NOP
+L203:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L204
+NOP
+L204:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f7_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L207:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L205
+NOP
+SW $t1, 296($fp)
+J L206
+NOP
+L205:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L207
+NOP
+L206:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L208
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L209
+NOP
+L208:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L210
+NOP
+L209:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L210:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L211
+NOP
+SW $t1, 248($fp)
+J L212
+NOP
+L211:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L210
+NOP
+L212:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L213
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L214
+NOP
+L213:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L215
+NOP
+L214:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L215:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L216
+NOP
+SW $t1, 192($fp)
+J L217
+NOP
+L216:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L215
+NOP
+L217:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L218
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L219
+NOP
+L218:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L220
+NOP
+L219:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L220:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L221
+NOP
+SW $t1, 136($fp)
+J L222
+NOP
+L221:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L220
+NOP
+L222:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L223
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L224
+NOP
+L223:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L225
+NOP
+L224:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L225:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L226
+NOP
+SW $t1, 80($fp)
+J L227
+NOP
+L226:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L225
+NOP
+L227:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L228
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L229
+NOP
+L228:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L230
+NOP
+L229:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L230:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L231
+NOP
+SW $t1, 24($fp)
+J L232
+NOP
+L231:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L230
+NOP
+L232:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L233
+NOP
+L233:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f8_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L236:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L234
+NOP
+SW $t1, 296($fp)
+J L235
+NOP
+L234:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L236
+NOP
+L235:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L237
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L238
+NOP
+L237:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L239
+NOP
+L238:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L239:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L240
+NOP
+SW $t1, 248($fp)
+J L241
+NOP
+L240:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L239
+NOP
+L241:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L242
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L243
+NOP
+L242:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L244
+NOP
+L243:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L244:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L245
+NOP
+SW $t1, 192($fp)
+J L246
+NOP
+L245:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L244
+NOP
+L246:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L247
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L248
+NOP
+L247:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L249
+NOP
+L248:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L249:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L250
+NOP
+SW $t1, 136($fp)
+J L251
+NOP
+L250:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L249
+NOP
+L251:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L252
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L253
+NOP
+L252:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L254
+NOP
+L253:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L254:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L255
+NOP
+SW $t1, 80($fp)
+J L256
+NOP
+L255:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L254
+NOP
+L256:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L257
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L258
+NOP
+L257:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L259
+NOP
+L258:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L259:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L260
+NOP
+SW $t1, 24($fp)
+J L261
+NOP
+L260:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L259
+NOP
+L261:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L262
+NOP
+L262:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f9_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L265:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L263
+NOP
+SW $t1, 296($fp)
+J L264
+NOP
+L263:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L265
+NOP
+L264:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L266
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L267
+NOP
+L266:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L268
+NOP
+L267:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L268:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L269
+NOP
+SW $t1, 248($fp)
+J L270
+NOP
+L269:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L268
+NOP
+L270:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L271
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L272
+NOP
+L271:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L273
+NOP
+L272:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L273:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L274
+NOP
+SW $t1, 192($fp)
+J L275
+NOP
+L274:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L273
+NOP
+L275:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L276
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L277
+NOP
+L276:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L278
+NOP
+L277:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L278:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L279
+NOP
+SW $t1, 136($fp)
+J L280
+NOP
+L279:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L278
+NOP
+L280:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L281
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L282
+NOP
+L281:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L283
+NOP
+L282:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L283:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L284
+NOP
+SW $t1, 80($fp)
+J L285
+NOP
+L284:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L283
+NOP
+L285:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L286
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L287
+NOP
+L286:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L288
+NOP
+L287:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L288:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L289
+NOP
+SW $t1, 24($fp)
+J L290
+NOP
+L289:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L288
+NOP
+L290:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L291
+NOP
+L291:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f10_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L294:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L292
+NOP
+SW $t1, 296($fp)
+J L293
+NOP
+L292:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L294
+NOP
+L293:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L295
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L296
+NOP
+L295:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L297
+NOP
+L296:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L297:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L298
+NOP
+SW $t1, 248($fp)
+J L299
+NOP
+L298:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L297
+NOP
+L299:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L300
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L301
+NOP
+L300:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L302
+NOP
+L301:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L302:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L303
+NOP
+SW $t1, 192($fp)
+J L304
+NOP
+L303:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L302
+NOP
+L304:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L305
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L306
+NOP
+L305:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L307
+NOP
+L306:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L307:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L308
+NOP
+SW $t1, 136($fp)
+J L309
+NOP
+L308:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L307
+NOP
+L309:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L310
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L311
+NOP
+L310:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L312
+NOP
+L311:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L312:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L313
+NOP
+SW $t1, 80($fp)
+J L314
+NOP
+L313:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L312
+NOP
+L314:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L315
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L316
+NOP
+L315:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L317
+NOP
+L316:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L317:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L318
+NOP
+SW $t1, 24($fp)
+J L319
+NOP
+L318:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L317
+NOP
+L319:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L320
+NOP
+L320:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f11_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L323:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L321
+NOP
+SW $t1, 296($fp)
+J L322
+NOP
+L321:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L323
+NOP
+L322:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L324
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L325
+NOP
+L324:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L326
+NOP
+L325:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L326:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L327
+NOP
+SW $t1, 248($fp)
+J L328
+NOP
+L327:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L326
+NOP
+L328:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L329
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L330
+NOP
+L329:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L331
+NOP
+L330:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L331:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L332
+NOP
+SW $t1, 192($fp)
+J L333
+NOP
+L332:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L331
+NOP
+L333:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L334
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L335
+NOP
+L334:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L336
+NOP
+L335:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L336:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L337
+NOP
+SW $t1, 136($fp)
+J L338
+NOP
+L337:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L336
+NOP
+L338:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L339
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L340
+NOP
+L339:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L341
+NOP
+L340:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L341:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L342
+NOP
+SW $t1, 80($fp)
+J L343
+NOP
+L342:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L341
+NOP
+L343:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L344
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L345
+NOP
+L344:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L346
+NOP
+L345:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L346:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L347
+NOP
+SW $t1, 24($fp)
+J L348
+NOP
+L347:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L346
+NOP
+L348:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L349
+NOP
+L349:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f12_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L352:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L350
+NOP
+SW $t1, 296($fp)
+J L351
+NOP
+L350:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L352
+NOP
+L351:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L353
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L354
+NOP
+L353:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L355
+NOP
+L354:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L355:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L356
+NOP
+SW $t1, 248($fp)
+J L357
+NOP
+L356:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L355
+NOP
+L357:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L358
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L359
+NOP
+L358:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L360
+NOP
+L359:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L360:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L361
+NOP
+SW $t1, 192($fp)
+J L362
+NOP
+L361:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L360
+NOP
+L362:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L363
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L364
+NOP
+L363:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L365
+NOP
+L364:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L365:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L366
+NOP
+SW $t1, 136($fp)
+J L367
+NOP
+L366:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L365
+NOP
+L367:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L368
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L369
+NOP
+L368:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L370
+NOP
+L369:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L370:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L371
+NOP
+SW $t1, 80($fp)
+J L372
+NOP
+L371:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L370
+NOP
+L372:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L373
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L374
+NOP
+L373:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L375
+NOP
+L374:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L375:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L376
+NOP
+SW $t1, 24($fp)
+J L377
+NOP
+L376:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L375
+NOP
+L377:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L378
+NOP
+L378:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f13_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L381:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L379
+NOP
+SW $t1, 296($fp)
+J L380
+NOP
+L379:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L381
+NOP
+L380:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L382
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L383
+NOP
+L382:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L384
+NOP
+L383:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L384:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L385
+NOP
+SW $t1, 248($fp)
+J L386
+NOP
+L385:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L384
+NOP
+L386:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L387
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L388
+NOP
+L387:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L389
+NOP
+L388:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L389:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L390
+NOP
+SW $t1, 192($fp)
+J L391
+NOP
+L390:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L389
+NOP
+L391:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L392
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L393
+NOP
+L392:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L394
+NOP
+L393:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L394:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L395
+NOP
+SW $t1, 136($fp)
+J L396
+NOP
+L395:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L394
+NOP
+L396:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L397
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L398
+NOP
+L397:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L399
+NOP
+L398:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L399:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L400
+NOP
+SW $t1, 80($fp)
+J L401
+NOP
+L400:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L399
+NOP
+L401:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L402
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L403
+NOP
+L402:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L404
+NOP
+L403:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L404:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L405
+NOP
+SW $t1, 24($fp)
+J L406
+NOP
+L405:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L404
+NOP
+L406:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L407
+NOP
+L407:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f14_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L410:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L408
+NOP
+SW $t1, 296($fp)
+J L409
+NOP
+L408:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L410
+NOP
+L409:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L411
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L412
+NOP
+L411:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L413
+NOP
+L412:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L413:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L414
+NOP
+SW $t1, 248($fp)
+J L415
+NOP
+L414:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L413
+NOP
+L415:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L416
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L417
+NOP
+L416:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L418
+NOP
+L417:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L418:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L419
+NOP
+SW $t1, 192($fp)
+J L420
+NOP
+L419:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L418
+NOP
+L420:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L421
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L422
+NOP
+L421:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L423
+NOP
+L422:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L423:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L424
+NOP
+SW $t1, 136($fp)
+J L425
+NOP
+L424:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L423
+NOP
+L425:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L426
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L427
+NOP
+L426:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L428
+NOP
+L427:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L428:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L429
+NOP
+SW $t1, 80($fp)
+J L430
+NOP
+L429:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L428
+NOP
+L430:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L431
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L432
+NOP
+L431:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L433
+NOP
+L432:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L433:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L434
+NOP
+SW $t1, 24($fp)
+J L435
+NOP
+L434:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L433
+NOP
+L435:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L436
+NOP
+L436:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f15_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L439:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L437
+NOP
+SW $t1, 296($fp)
+J L438
+NOP
+L437:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L439
+NOP
+L438:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L440
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L441
+NOP
+L440:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L442
+NOP
+L441:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L442:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L443
+NOP
+SW $t1, 248($fp)
+J L444
+NOP
+L443:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L442
+NOP
+L444:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L445
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L446
+NOP
+L445:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L447
+NOP
+L446:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L447:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L448
+NOP
+SW $t1, 192($fp)
+J L449
+NOP
+L448:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L447
+NOP
+L449:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L450
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L451
+NOP
+L450:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L452
+NOP
+L451:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L452:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L453
+NOP
+SW $t1, 136($fp)
+J L454
+NOP
+L453:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L452
+NOP
+L454:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L455
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L456
+NOP
+L455:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L457
+NOP
+L456:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L457:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L458
+NOP
+SW $t1, 80($fp)
+J L459
+NOP
+L458:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L457
+NOP
+L459:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L460
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L461
+NOP
+L460:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L462
+NOP
+L461:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L462:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L463
+NOP
+SW $t1, 24($fp)
+J L464
+NOP
+L463:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L462
+NOP
+L464:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L465
+NOP
+L465:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f16_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L468:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L466
+NOP
+SW $t1, 296($fp)
+J L467
+NOP
+L466:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L468
+NOP
+L467:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L469
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L470
+NOP
+L469:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L471
+NOP
+L470:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L471:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L472
+NOP
+SW $t1, 248($fp)
+J L473
+NOP
+L472:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L471
+NOP
+L473:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L474
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L475
+NOP
+L474:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L476
+NOP
+L475:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L476:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L477
+NOP
+SW $t1, 192($fp)
+J L478
+NOP
+L477:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L476
+NOP
+L478:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L479
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L480
+NOP
+L479:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L481
+NOP
+L480:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L481:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L482
+NOP
+SW $t1, 136($fp)
+J L483
+NOP
+L482:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L481
+NOP
+L483:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L484
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L485
+NOP
+L484:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L486
+NOP
+L485:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L486:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L487
+NOP
+SW $t1, 80($fp)
+J L488
+NOP
+L487:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L486
+NOP
+L488:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L489
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L490
+NOP
+L489:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L491
+NOP
+L490:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L491:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L492
+NOP
+SW $t1, 24($fp)
+J L493
+NOP
+L492:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L491
+NOP
+L493:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L494
+NOP
+L494:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f17_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L497:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L495
+NOP
+SW $t1, 296($fp)
+J L496
+NOP
+L495:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L497
+NOP
+L496:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L498
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L499
+NOP
+L498:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L500
+NOP
+L499:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L500:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L501
+NOP
+SW $t1, 248($fp)
+J L502
+NOP
+L501:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L500
+NOP
+L502:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L503
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L504
+NOP
+L503:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L505
+NOP
+L504:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L505:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L506
+NOP
+SW $t1, 192($fp)
+J L507
+NOP
+L506:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L505
+NOP
+L507:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L508
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L509
+NOP
+L508:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L510
+NOP
+L509:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L510:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L511
+NOP
+SW $t1, 136($fp)
+J L512
+NOP
+L511:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L510
+NOP
+L512:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L513
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L514
+NOP
+L513:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L515
+NOP
+L514:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L515:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L516
+NOP
+SW $t1, 80($fp)
+J L517
+NOP
+L516:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L515
+NOP
+L517:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L518
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L519
+NOP
+L518:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L520
+NOP
+L519:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L520:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L521
+NOP
+SW $t1, 24($fp)
+J L522
+NOP
+L521:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L520
+NOP
+L522:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L523
+NOP
+L523:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f18_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L526:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L524
+NOP
+SW $t1, 296($fp)
+J L525
+NOP
+L524:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L526
+NOP
+L525:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L527
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L528
+NOP
+L527:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L529
+NOP
+L528:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L529:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L530
+NOP
+SW $t1, 248($fp)
+J L531
+NOP
+L530:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L529
+NOP
+L531:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L532
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L533
+NOP
+L532:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L534
+NOP
+L533:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L534:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L535
+NOP
+SW $t1, 192($fp)
+J L536
+NOP
+L535:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L534
+NOP
+L536:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L537
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L538
+NOP
+L537:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L539
+NOP
+L538:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L539:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L540
+NOP
+SW $t1, 136($fp)
+J L541
+NOP
+L540:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L539
+NOP
+L541:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L542
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L543
+NOP
+L542:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L544
+NOP
+L543:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L544:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L545
+NOP
+SW $t1, 80($fp)
+J L546
+NOP
+L545:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L544
+NOP
+L546:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L547
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L548
+NOP
+L547:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L549
+NOP
+L548:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L549:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L550
+NOP
+SW $t1, 24($fp)
+J L551
+NOP
+L550:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L549
+NOP
+L551:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L552
+NOP
+L552:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f19_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L555:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L553
+NOP
+SW $t1, 296($fp)
+J L554
+NOP
+L553:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L555
+NOP
+L554:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L556
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L557
+NOP
+L556:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L558
+NOP
+L557:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L558:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L559
+NOP
+SW $t1, 248($fp)
+J L560
+NOP
+L559:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L558
+NOP
+L560:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L561
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L562
+NOP
+L561:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L563
+NOP
+L562:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L563:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L564
+NOP
+SW $t1, 192($fp)
+J L565
+NOP
+L564:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L563
+NOP
+L565:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L566
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L567
+NOP
+L566:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L568
+NOP
+L567:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L568:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L569
+NOP
+SW $t1, 136($fp)
+J L570
+NOP
+L569:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L568
+NOP
+L570:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L571
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L572
+NOP
+L571:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L573
+NOP
+L572:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L573:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L574
+NOP
+SW $t1, 80($fp)
+J L575
+NOP
+L574:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L573
+NOP
+L575:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L576
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L577
+NOP
+L576:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L578
+NOP
+L577:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L578:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L579
+NOP
+SW $t1, 24($fp)
+J L580
+NOP
+L579:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L578
+NOP
+L580:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L581
+NOP
+L581:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f20_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L584:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L582
+NOP
+SW $t1, 296($fp)
+J L583
+NOP
+L582:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L584
+NOP
+L583:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L585
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L586
+NOP
+L585:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L587
+NOP
+L586:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L587:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L588
+NOP
+SW $t1, 248($fp)
+J L589
+NOP
+L588:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L587
+NOP
+L589:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L590
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L591
+NOP
+L590:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L592
+NOP
+L591:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L592:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L593
+NOP
+SW $t1, 192($fp)
+J L594
+NOP
+L593:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L592
+NOP
+L594:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L595
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L596
+NOP
+L595:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L597
+NOP
+L596:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L597:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L598
+NOP
+SW $t1, 136($fp)
+J L599
+NOP
+L598:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L597
+NOP
+L599:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L600
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L601
+NOP
+L600:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L602
+NOP
+L601:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L602:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L603
+NOP
+SW $t1, 80($fp)
+J L604
+NOP
+L603:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L602
+NOP
+L604:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L605
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L606
+NOP
+L605:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L607
+NOP
+L606:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L607:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L608
+NOP
+SW $t1, 24($fp)
+J L609
+NOP
+L608:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L607
+NOP
+L609:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L610
+NOP
+L610:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f21_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L613:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L611
+NOP
+SW $t1, 296($fp)
+J L612
+NOP
+L611:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L613
+NOP
+L612:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L614
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L615
+NOP
+L614:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L616
+NOP
+L615:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L616:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L617
+NOP
+SW $t1, 248($fp)
+J L618
+NOP
+L617:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L616
+NOP
+L618:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L619
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L620
+NOP
+L619:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L621
+NOP
+L620:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L621:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L622
+NOP
+SW $t1, 192($fp)
+J L623
+NOP
+L622:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L621
+NOP
+L623:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L624
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L625
+NOP
+L624:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L626
+NOP
+L625:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L626:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L627
+NOP
+SW $t1, 136($fp)
+J L628
+NOP
+L627:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L626
+NOP
+L628:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L629
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L630
+NOP
+L629:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L631
+NOP
+L630:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L631:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L632
+NOP
+SW $t1, 80($fp)
+J L633
+NOP
+L632:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L631
+NOP
+L633:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L634
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L635
+NOP
+L634:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L636
+NOP
+L635:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L636:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L637
+NOP
+SW $t1, 24($fp)
+J L638
+NOP
+L637:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L636
+NOP
+L638:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L639
+NOP
+L639:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f22_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L642:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L640
+NOP
+SW $t1, 296($fp)
+J L641
+NOP
+L640:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L642
+NOP
+L641:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L643
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L644
+NOP
+L643:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L645
+NOP
+L644:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L645:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L646
+NOP
+SW $t1, 248($fp)
+J L647
+NOP
+L646:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L645
+NOP
+L647:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L648
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L649
+NOP
+L648:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L650
+NOP
+L649:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L650:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L651
+NOP
+SW $t1, 192($fp)
+J L652
+NOP
+L651:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L650
+NOP
+L652:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L653
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L654
+NOP
+L653:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L655
+NOP
+L654:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L655:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L656
+NOP
+SW $t1, 136($fp)
+J L657
+NOP
+L656:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L655
+NOP
+L657:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L658
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L659
+NOP
+L658:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L660
+NOP
+L659:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L660:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L661
+NOP
+SW $t1, 80($fp)
+J L662
+NOP
+L661:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L660
+NOP
+L662:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L663
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L664
+NOP
+L663:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L665
+NOP
+L664:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L665:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L666
+NOP
+SW $t1, 24($fp)
+J L667
+NOP
+L666:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L665
+NOP
+L667:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L668
+NOP
+L668:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f23_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L671:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L669
+NOP
+SW $t1, 296($fp)
+J L670
+NOP
+L669:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L671
+NOP
+L670:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L672
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L673
+NOP
+L672:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L674
+NOP
+L673:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L674:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L675
+NOP
+SW $t1, 248($fp)
+J L676
+NOP
+L675:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L674
+NOP
+L676:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L677
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L678
+NOP
+L677:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L679
+NOP
+L678:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L679:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L680
+NOP
+SW $t1, 192($fp)
+J L681
+NOP
+L680:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L679
+NOP
+L681:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L682
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L683
+NOP
+L682:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L684
+NOP
+L683:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L684:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L685
+NOP
+SW $t1, 136($fp)
+J L686
+NOP
+L685:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L684
+NOP
+L686:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L687
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L688
+NOP
+L687:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L689
+NOP
+L688:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L689:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L690
+NOP
+SW $t1, 80($fp)
+J L691
+NOP
+L690:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L689
+NOP
+L691:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L692
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L693
+NOP
+L692:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L694
+NOP
+L693:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L694:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L695
+NOP
+SW $t1, 24($fp)
+J L696
+NOP
+L695:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L694
+NOP
+L696:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L697
+NOP
+L697:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f24_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L700:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L698
+NOP
+SW $t1, 296($fp)
+J L699
+NOP
+L698:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L700
+NOP
+L699:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L701
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L702
+NOP
+L701:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L703
+NOP
+L702:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L703:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L704
+NOP
+SW $t1, 248($fp)
+J L705
+NOP
+L704:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L703
+NOP
+L705:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L706
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L707
+NOP
+L706:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L708
+NOP
+L707:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L708:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L709
+NOP
+SW $t1, 192($fp)
+J L710
+NOP
+L709:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L708
+NOP
+L710:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L711
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L712
+NOP
+L711:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L713
+NOP
+L712:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L713:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L714
+NOP
+SW $t1, 136($fp)
+J L715
+NOP
+L714:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L713
+NOP
+L715:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L716
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L717
+NOP
+L716:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L718
+NOP
+L717:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L718:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L719
+NOP
+SW $t1, 80($fp)
+J L720
+NOP
+L719:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L718
+NOP
+L720:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L721
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L722
+NOP
+L721:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L723
+NOP
+L722:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L723:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L724
+NOP
+SW $t1, 24($fp)
+J L725
+NOP
+L724:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L723
+NOP
+L725:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L726
+NOP
+L726:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f25_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L729:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L727
+NOP
+SW $t1, 296($fp)
+J L728
+NOP
+L727:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L729
+NOP
+L728:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L730
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L731
+NOP
+L730:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L732
+NOP
+L731:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L732:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L733
+NOP
+SW $t1, 248($fp)
+J L734
+NOP
+L733:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L732
+NOP
+L734:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L735
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L736
+NOP
+L735:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L737
+NOP
+L736:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L737:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L738
+NOP
+SW $t1, 192($fp)
+J L739
+NOP
+L738:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L737
+NOP
+L739:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L740
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L741
+NOP
+L740:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L742
+NOP
+L741:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L742:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L743
+NOP
+SW $t1, 136($fp)
+J L744
+NOP
+L743:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L742
+NOP
+L744:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L745
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L746
+NOP
+L745:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L747
+NOP
+L746:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L747:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L748
+NOP
+SW $t1, 80($fp)
+J L749
+NOP
+L748:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L747
+NOP
+L749:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L750
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L751
+NOP
+L750:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L752
+NOP
+L751:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L752:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L753
+NOP
+SW $t1, 24($fp)
+J L754
+NOP
+L753:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L752
+NOP
+L754:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L755
+NOP
+L755:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f26_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L758:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L756
+NOP
+SW $t1, 296($fp)
+J L757
+NOP
+L756:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L758
+NOP
+L757:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L759
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L760
+NOP
+L759:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L761
+NOP
+L760:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L761:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L762
+NOP
+SW $t1, 248($fp)
+J L763
+NOP
+L762:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L761
+NOP
+L763:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L764
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L765
+NOP
+L764:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L766
+NOP
+L765:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L766:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L767
+NOP
+SW $t1, 192($fp)
+J L768
+NOP
+L767:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L766
+NOP
+L768:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L769
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L770
+NOP
+L769:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L771
+NOP
+L770:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L771:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L772
+NOP
+SW $t1, 136($fp)
+J L773
+NOP
+L772:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L771
+NOP
+L773:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L774
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L775
+NOP
+L774:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L776
+NOP
+L775:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L776:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L777
+NOP
+SW $t1, 80($fp)
+J L778
+NOP
+L777:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L776
+NOP
+L778:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L779
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L780
+NOP
+L779:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L781
+NOP
+L780:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L781:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L782
+NOP
+SW $t1, 24($fp)
+J L783
+NOP
+L782:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L781
+NOP
+L783:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L784
+NOP
+L784:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f27_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L787:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L785
+NOP
+SW $t1, 296($fp)
+J L786
+NOP
+L785:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L787
+NOP
+L786:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L788
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L789
+NOP
+L788:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L790
+NOP
+L789:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L790:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L791
+NOP
+SW $t1, 248($fp)
+J L792
+NOP
+L791:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L790
+NOP
+L792:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L793
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L794
+NOP
+L793:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L795
+NOP
+L794:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L795:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L796
+NOP
+SW $t1, 192($fp)
+J L797
+NOP
+L796:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L795
+NOP
+L797:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L798
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L799
+NOP
+L798:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L800
+NOP
+L799:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L800:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L801
+NOP
+SW $t1, 136($fp)
+J L802
+NOP
+L801:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L800
+NOP
+L802:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L803
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L804
+NOP
+L803:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L805
+NOP
+L804:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L805:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L806
+NOP
+SW $t1, 80($fp)
+J L807
+NOP
+L806:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L805
+NOP
+L807:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L808
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L809
+NOP
+L808:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L810
+NOP
+L809:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L810:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L811
+NOP
+SW $t1, 24($fp)
+J L812
+NOP
+L811:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L810
+NOP
+L812:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L813
+NOP
+L813:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f28_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L816:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L814
+NOP
+SW $t1, 296($fp)
+J L815
+NOP
+L814:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L816
+NOP
+L815:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L817
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L818
+NOP
+L817:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L819
+NOP
+L818:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L819:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L820
+NOP
+SW $t1, 248($fp)
+J L821
+NOP
+L820:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L819
+NOP
+L821:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L822
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L823
+NOP
+L822:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L824
+NOP
+L823:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L824:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L825
+NOP
+SW $t1, 192($fp)
+J L826
+NOP
+L825:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L824
+NOP
+L826:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L827
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L828
+NOP
+L827:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L829
+NOP
+L828:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L829:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L830
+NOP
+SW $t1, 136($fp)
+J L831
+NOP
+L830:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L829
+NOP
+L831:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L832
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L833
+NOP
+L832:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L834
+NOP
+L833:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L834:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L835
+NOP
+SW $t1, 80($fp)
+J L836
+NOP
+L835:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L834
+NOP
+L836:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L837
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L838
+NOP
+L837:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L839
+NOP
+L838:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L839:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L840
+NOP
+SW $t1, 24($fp)
+J L841
+NOP
+L840:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L839
+NOP
+L841:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L842
+NOP
+L842:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f29_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L845:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L843
+NOP
+SW $t1, 296($fp)
+J L844
+NOP
+L843:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L845
+NOP
+L844:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L846
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L847
+NOP
+L846:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L848
+NOP
+L847:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L848:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L849
+NOP
+SW $t1, 248($fp)
+J L850
+NOP
+L849:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L848
+NOP
+L850:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L851
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L852
+NOP
+L851:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L853
+NOP
+L852:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L853:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L854
+NOP
+SW $t1, 192($fp)
+J L855
+NOP
+L854:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L853
+NOP
+L855:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L856
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L857
+NOP
+L856:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L858
+NOP
+L857:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L858:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L859
+NOP
+SW $t1, 136($fp)
+J L860
+NOP
+L859:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L858
+NOP
+L860:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L861
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L862
+NOP
+L861:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L863
+NOP
+L862:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L863:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L864
+NOP
+SW $t1, 80($fp)
+J L865
+NOP
+L864:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L863
+NOP
+L865:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L866
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L867
+NOP
+L866:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L868
+NOP
+L867:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L868:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L869
+NOP
+SW $t1, 24($fp)
+J L870
+NOP
+L869:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L868
+NOP
+L870:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L871
+NOP
+L871:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f30_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L874:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L872
+NOP
+SW $t1, 296($fp)
+J L873
+NOP
+L872:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L874
+NOP
+L873:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L875
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L876
+NOP
+L875:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L877
+NOP
+L876:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L877:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L878
+NOP
+SW $t1, 248($fp)
+J L879
+NOP
+L878:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L877
+NOP
+L879:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L880
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L881
+NOP
+L880:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L882
+NOP
+L881:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L882:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L883
+NOP
+SW $t1, 192($fp)
+J L884
+NOP
+L883:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L882
+NOP
+L884:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L885
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L886
+NOP
+L885:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L887
+NOP
+L886:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L887:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L888
+NOP
+SW $t1, 136($fp)
+J L889
+NOP
+L888:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L887
+NOP
+L889:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L890
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L891
+NOP
+L890:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L892
+NOP
+L891:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L892:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L893
+NOP
+SW $t1, 80($fp)
+J L894
+NOP
+L893:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L892
+NOP
+L894:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L895
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L896
+NOP
+L895:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L897
+NOP
+L896:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L897:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L898
+NOP
+SW $t1, 24($fp)
+J L899
+NOP
+L898:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L897
+NOP
+L899:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L900
+NOP
+L900:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f31_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L903:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L901
+NOP
+SW $t1, 296($fp)
+J L902
+NOP
+L901:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L903
+NOP
+L902:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L904
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L905
+NOP
+L904:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L906
+NOP
+L905:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L906:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L907
+NOP
+SW $t1, 248($fp)
+J L908
+NOP
+L907:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L906
+NOP
+L908:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L909
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L910
+NOP
+L909:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L911
+NOP
+L910:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L911:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L912
+NOP
+SW $t1, 192($fp)
+J L913
+NOP
+L912:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L911
+NOP
+L913:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L914
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L915
+NOP
+L914:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L916
+NOP
+L915:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L916:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L917
+NOP
+SW $t1, 136($fp)
+J L918
+NOP
+L917:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L916
+NOP
+L918:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L919
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L920
+NOP
+L919:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L921
+NOP
+L920:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L921:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L922
+NOP
+SW $t1, 80($fp)
+J L923
+NOP
+L922:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L921
+NOP
+L923:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L924
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L925
+NOP
+L924:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L926
+NOP
+L925:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L926:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L927
+NOP
+SW $t1, 24($fp)
+J L928
+NOP
+L927:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L926
+NOP
+L928:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L929
+NOP
+L929:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f32_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L932:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L930
+NOP
+SW $t1, 296($fp)
+J L931
+NOP
+L930:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L932
+NOP
+L931:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L933
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L934
+NOP
+L933:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L935
+NOP
+L934:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L935:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L936
+NOP
+SW $t1, 248($fp)
+J L937
+NOP
+L936:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L935
+NOP
+L937:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L938
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L939
+NOP
+L938:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L940
+NOP
+L939:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L940:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L941
+NOP
+SW $t1, 192($fp)
+J L942
+NOP
+L941:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L940
+NOP
+L942:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L943
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L944
+NOP
+L943:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L945
+NOP
+L944:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L945:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L946
+NOP
+SW $t1, 136($fp)
+J L947
+NOP
+L946:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L945
+NOP
+L947:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L948
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L949
+NOP
+L948:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L950
+NOP
+L949:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L950:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L951
+NOP
+SW $t1, 80($fp)
+J L952
+NOP
+L951:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L950
+NOP
+L952:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L953
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L954
+NOP
+L953:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L955
+NOP
+L954:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L955:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L956
+NOP
+SW $t1, 24($fp)
+J L957
+NOP
+L956:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L955
+NOP
+L957:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L958
+NOP
+L958:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f33_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L961:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L959
+NOP
+SW $t1, 296($fp)
+J L960
+NOP
+L959:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L961
+NOP
+L960:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L962
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L963
+NOP
+L962:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L964
+NOP
+L963:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L964:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L965
+NOP
+SW $t1, 248($fp)
+J L966
+NOP
+L965:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L964
+NOP
+L966:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L967
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L968
+NOP
+L967:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L969
+NOP
+L968:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L969:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L970
+NOP
+SW $t1, 192($fp)
+J L971
+NOP
+L970:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L969
+NOP
+L971:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L972
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L973
+NOP
+L972:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L974
+NOP
+L973:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L974:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L975
+NOP
+SW $t1, 136($fp)
+J L976
+NOP
+L975:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L974
+NOP
+L976:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L977
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L978
+NOP
+L977:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L979
+NOP
+L978:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L979:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L980
+NOP
+SW $t1, 80($fp)
+J L981
+NOP
+L980:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L979
+NOP
+L981:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L982
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L983
+NOP
+L982:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L984
+NOP
+L983:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L984:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L985
+NOP
+SW $t1, 24($fp)
+J L986
+NOP
+L985:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L984
+NOP
+L986:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L987
+NOP
+L987:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f34_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L990:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L988
+NOP
+SW $t1, 296($fp)
+J L989
+NOP
+L988:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L990
+NOP
+L989:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L991
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L992
+NOP
+L991:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L993
+NOP
+L992:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L993:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L994
+NOP
+SW $t1, 248($fp)
+J L995
+NOP
+L994:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L993
+NOP
+L995:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L996
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L997
+NOP
+L996:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L998
+NOP
+L997:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L998:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L999
+NOP
+SW $t1, 192($fp)
+J L1000
+NOP
+L999:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L998
+NOP
+L1000:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1001
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1002
+NOP
+L1001:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1003
+NOP
+L1002:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1003:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1004
+NOP
+SW $t1, 136($fp)
+J L1005
+NOP
+L1004:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1003
+NOP
+L1005:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1006
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1007
+NOP
+L1006:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1008
+NOP
+L1007:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1008:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1009
+NOP
+SW $t1, 80($fp)
+J L1010
+NOP
+L1009:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1008
+NOP
+L1010:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1011
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1012
+NOP
+L1011:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1013
+NOP
+L1012:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1013:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1014
+NOP
+SW $t1, 24($fp)
+J L1015
+NOP
+L1014:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1013
+NOP
+L1015:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1016
+NOP
+L1016:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f35_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1019:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1017
+NOP
+SW $t1, 296($fp)
+J L1018
+NOP
+L1017:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1019
+NOP
+L1018:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1020
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1021
+NOP
+L1020:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1022
+NOP
+L1021:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1022:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1023
+NOP
+SW $t1, 248($fp)
+J L1024
+NOP
+L1023:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1022
+NOP
+L1024:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1025
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1026
+NOP
+L1025:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1027
+NOP
+L1026:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1027:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1028
+NOP
+SW $t1, 192($fp)
+J L1029
+NOP
+L1028:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1027
+NOP
+L1029:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1030
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1031
+NOP
+L1030:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1032
+NOP
+L1031:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1032:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1033
+NOP
+SW $t1, 136($fp)
+J L1034
+NOP
+L1033:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1032
+NOP
+L1034:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1035
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1036
+NOP
+L1035:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1037
+NOP
+L1036:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1037:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1038
+NOP
+SW $t1, 80($fp)
+J L1039
+NOP
+L1038:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1037
+NOP
+L1039:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1040
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1041
+NOP
+L1040:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1042
+NOP
+L1041:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1042:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1043
+NOP
+SW $t1, 24($fp)
+J L1044
+NOP
+L1043:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1042
+NOP
+L1044:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1045
+NOP
+L1045:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f36_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1048:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1046
+NOP
+SW $t1, 296($fp)
+J L1047
+NOP
+L1046:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1048
+NOP
+L1047:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1049
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1050
+NOP
+L1049:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1051
+NOP
+L1050:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1051:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1052
+NOP
+SW $t1, 248($fp)
+J L1053
+NOP
+L1052:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1051
+NOP
+L1053:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1054
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1055
+NOP
+L1054:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1056
+NOP
+L1055:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1056:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1057
+NOP
+SW $t1, 192($fp)
+J L1058
+NOP
+L1057:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1056
+NOP
+L1058:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1059
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1060
+NOP
+L1059:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1061
+NOP
+L1060:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1061:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1062
+NOP
+SW $t1, 136($fp)
+J L1063
+NOP
+L1062:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1061
+NOP
+L1063:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1064
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1065
+NOP
+L1064:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1066
+NOP
+L1065:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1066:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1067
+NOP
+SW $t1, 80($fp)
+J L1068
+NOP
+L1067:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1066
+NOP
+L1068:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1069
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1070
+NOP
+L1069:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1071
+NOP
+L1070:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1071:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1072
+NOP
+SW $t1, 24($fp)
+J L1073
+NOP
+L1072:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1071
+NOP
+L1073:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1074
+NOP
+L1074:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f37_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1077:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1075
+NOP
+SW $t1, 296($fp)
+J L1076
+NOP
+L1075:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1077
+NOP
+L1076:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1078
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1079
+NOP
+L1078:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1080
+NOP
+L1079:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1080:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1081
+NOP
+SW $t1, 248($fp)
+J L1082
+NOP
+L1081:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1080
+NOP
+L1082:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1083
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1084
+NOP
+L1083:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1085
+NOP
+L1084:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1085:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1086
+NOP
+SW $t1, 192($fp)
+J L1087
+NOP
+L1086:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1085
+NOP
+L1087:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1088
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1089
+NOP
+L1088:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1090
+NOP
+L1089:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1090:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1091
+NOP
+SW $t1, 136($fp)
+J L1092
+NOP
+L1091:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1090
+NOP
+L1092:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1093
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1094
+NOP
+L1093:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1095
+NOP
+L1094:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1095:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1096
+NOP
+SW $t1, 80($fp)
+J L1097
+NOP
+L1096:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1095
+NOP
+L1097:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1098
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1099
+NOP
+L1098:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1100
+NOP
+L1099:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1100:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1101
+NOP
+SW $t1, 24($fp)
+J L1102
+NOP
+L1101:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1100
+NOP
+L1102:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1103
+NOP
+L1103:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f38_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1106:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1104
+NOP
+SW $t1, 296($fp)
+J L1105
+NOP
+L1104:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1106
+NOP
+L1105:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1107
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1108
+NOP
+L1107:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1109
+NOP
+L1108:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1109:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1110
+NOP
+SW $t1, 248($fp)
+J L1111
+NOP
+L1110:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1109
+NOP
+L1111:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1112
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1113
+NOP
+L1112:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1114
+NOP
+L1113:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1114:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1115
+NOP
+SW $t1, 192($fp)
+J L1116
+NOP
+L1115:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1114
+NOP
+L1116:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1117
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1118
+NOP
+L1117:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1119
+NOP
+L1118:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1119:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1120
+NOP
+SW $t1, 136($fp)
+J L1121
+NOP
+L1120:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1119
+NOP
+L1121:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1122
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1123
+NOP
+L1122:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1124
+NOP
+L1123:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1124:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1125
+NOP
+SW $t1, 80($fp)
+J L1126
+NOP
+L1125:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1124
+NOP
+L1126:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1127
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1128
+NOP
+L1127:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1129
+NOP
+L1128:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1129:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1130
+NOP
+SW $t1, 24($fp)
+J L1131
+NOP
+L1130:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1129
+NOP
+L1131:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1132
+NOP
+L1132:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f39_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1135:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1133
+NOP
+SW $t1, 296($fp)
+J L1134
+NOP
+L1133:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1135
+NOP
+L1134:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1136
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1137
+NOP
+L1136:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1138
+NOP
+L1137:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1138:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1139
+NOP
+SW $t1, 248($fp)
+J L1140
+NOP
+L1139:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1138
+NOP
+L1140:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1141
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1142
+NOP
+L1141:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1143
+NOP
+L1142:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1143:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1144
+NOP
+SW $t1, 192($fp)
+J L1145
+NOP
+L1144:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1143
+NOP
+L1145:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1146
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1147
+NOP
+L1146:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1148
+NOP
+L1147:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1148:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1149
+NOP
+SW $t1, 136($fp)
+J L1150
+NOP
+L1149:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1148
+NOP
+L1150:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1151
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1152
+NOP
+L1151:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1153
+NOP
+L1152:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1153:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1154
+NOP
+SW $t1, 80($fp)
+J L1155
+NOP
+L1154:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1153
+NOP
+L1155:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1156
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1157
+NOP
+L1156:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1158
+NOP
+L1157:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1158:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1159
+NOP
+SW $t1, 24($fp)
+J L1160
+NOP
+L1159:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1158
+NOP
+L1160:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1161
+NOP
+L1161:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f40_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1164:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1162
+NOP
+SW $t1, 296($fp)
+J L1163
+NOP
+L1162:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1164
+NOP
+L1163:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1165
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1166
+NOP
+L1165:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1167
+NOP
+L1166:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1167:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1168
+NOP
+SW $t1, 248($fp)
+J L1169
+NOP
+L1168:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1167
+NOP
+L1169:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1170
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1171
+NOP
+L1170:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1172
+NOP
+L1171:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1172:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1173
+NOP
+SW $t1, 192($fp)
+J L1174
+NOP
+L1173:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1172
+NOP
+L1174:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1175
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1176
+NOP
+L1175:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1177
+NOP
+L1176:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1177:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1178
+NOP
+SW $t1, 136($fp)
+J L1179
+NOP
+L1178:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1177
+NOP
+L1179:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1180
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1181
+NOP
+L1180:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1182
+NOP
+L1181:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1182:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1183
+NOP
+SW $t1, 80($fp)
+J L1184
+NOP
+L1183:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1182
+NOP
+L1184:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1185
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1186
+NOP
+L1185:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1187
+NOP
+L1186:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1187:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1188
+NOP
+SW $t1, 24($fp)
+J L1189
+NOP
+L1188:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1187
+NOP
+L1189:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1190
+NOP
+L1190:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f41_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1193:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1191
+NOP
+SW $t1, 296($fp)
+J L1192
+NOP
+L1191:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1193
+NOP
+L1192:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1194
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1195
+NOP
+L1194:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1196
+NOP
+L1195:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1196:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1197
+NOP
+SW $t1, 248($fp)
+J L1198
+NOP
+L1197:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1196
+NOP
+L1198:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1199
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1200
+NOP
+L1199:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1201
+NOP
+L1200:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1201:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1202
+NOP
+SW $t1, 192($fp)
+J L1203
+NOP
+L1202:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1201
+NOP
+L1203:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1204
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1205
+NOP
+L1204:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1206
+NOP
+L1205:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1206:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1207
+NOP
+SW $t1, 136($fp)
+J L1208
+NOP
+L1207:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1206
+NOP
+L1208:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1209
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1210
+NOP
+L1209:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1211
+NOP
+L1210:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1211:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1212
+NOP
+SW $t1, 80($fp)
+J L1213
+NOP
+L1212:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1211
+NOP
+L1213:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1214
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1215
+NOP
+L1214:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1216
+NOP
+L1215:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1216:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1217
+NOP
+SW $t1, 24($fp)
+J L1218
+NOP
+L1217:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1216
+NOP
+L1218:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1219
+NOP
+L1219:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f42_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1222:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1220
+NOP
+SW $t1, 296($fp)
+J L1221
+NOP
+L1220:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1222
+NOP
+L1221:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1223
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1224
+NOP
+L1223:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1225
+NOP
+L1224:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1225:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1226
+NOP
+SW $t1, 248($fp)
+J L1227
+NOP
+L1226:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1225
+NOP
+L1227:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1228
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1229
+NOP
+L1228:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1230
+NOP
+L1229:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1230:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1231
+NOP
+SW $t1, 192($fp)
+J L1232
+NOP
+L1231:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1230
+NOP
+L1232:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1233
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1234
+NOP
+L1233:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1235
+NOP
+L1234:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1235:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1236
+NOP
+SW $t1, 136($fp)
+J L1237
+NOP
+L1236:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1235
+NOP
+L1237:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1238
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1239
+NOP
+L1238:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1240
+NOP
+L1239:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1240:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1241
+NOP
+SW $t1, 80($fp)
+J L1242
+NOP
+L1241:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1240
+NOP
+L1242:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1243
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1244
+NOP
+L1243:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1245
+NOP
+L1244:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1245:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1246
+NOP
+SW $t1, 24($fp)
+J L1247
+NOP
+L1246:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1245
+NOP
+L1247:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1248
+NOP
+L1248:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f43_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1251:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1249
+NOP
+SW $t1, 296($fp)
+J L1250
+NOP
+L1249:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1251
+NOP
+L1250:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1252
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1253
+NOP
+L1252:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1254
+NOP
+L1253:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1254:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1255
+NOP
+SW $t1, 248($fp)
+J L1256
+NOP
+L1255:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1254
+NOP
+L1256:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1257
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1258
+NOP
+L1257:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1259
+NOP
+L1258:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1259:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1260
+NOP
+SW $t1, 192($fp)
+J L1261
+NOP
+L1260:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1259
+NOP
+L1261:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1262
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1263
+NOP
+L1262:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1264
+NOP
+L1263:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1264:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1265
+NOP
+SW $t1, 136($fp)
+J L1266
+NOP
+L1265:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1264
+NOP
+L1266:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1267
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1268
+NOP
+L1267:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1269
+NOP
+L1268:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1269:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1270
+NOP
+SW $t1, 80($fp)
+J L1271
+NOP
+L1270:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1269
+NOP
+L1271:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1272
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1273
+NOP
+L1272:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1274
+NOP
+L1273:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1274:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1275
+NOP
+SW $t1, 24($fp)
+J L1276
+NOP
+L1275:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1274
+NOP
+L1276:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1277
+NOP
+L1277:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f44_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1280:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1278
+NOP
+SW $t1, 296($fp)
+J L1279
+NOP
+L1278:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1280
+NOP
+L1279:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1281
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1282
+NOP
+L1281:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1283
+NOP
+L1282:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1283:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1284
+NOP
+SW $t1, 248($fp)
+J L1285
+NOP
+L1284:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1283
+NOP
+L1285:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1286
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1287
+NOP
+L1286:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1288
+NOP
+L1287:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1288:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1289
+NOP
+SW $t1, 192($fp)
+J L1290
+NOP
+L1289:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1288
+NOP
+L1290:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1291
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1292
+NOP
+L1291:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1293
+NOP
+L1292:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1293:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1294
+NOP
+SW $t1, 136($fp)
+J L1295
+NOP
+L1294:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1293
+NOP
+L1295:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1296
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1297
+NOP
+L1296:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1298
+NOP
+L1297:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1298:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1299
+NOP
+SW $t1, 80($fp)
+J L1300
+NOP
+L1299:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1298
+NOP
+L1300:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1301
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1302
+NOP
+L1301:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1303
+NOP
+L1302:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1303:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1304
+NOP
+SW $t1, 24($fp)
+J L1305
+NOP
+L1304:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1303
+NOP
+L1305:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1306
+NOP
+L1306:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f45_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1309:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1307
+NOP
+SW $t1, 296($fp)
+J L1308
+NOP
+L1307:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1309
+NOP
+L1308:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1310
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1311
+NOP
+L1310:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1312
+NOP
+L1311:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1312:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1313
+NOP
+SW $t1, 248($fp)
+J L1314
+NOP
+L1313:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1312
+NOP
+L1314:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1315
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1316
+NOP
+L1315:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1317
+NOP
+L1316:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1317:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1318
+NOP
+SW $t1, 192($fp)
+J L1319
+NOP
+L1318:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1317
+NOP
+L1319:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1320
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1321
+NOP
+L1320:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1322
+NOP
+L1321:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1322:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1323
+NOP
+SW $t1, 136($fp)
+J L1324
+NOP
+L1323:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1322
+NOP
+L1324:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1325
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1326
+NOP
+L1325:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1327
+NOP
+L1326:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1327:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1328
+NOP
+SW $t1, 80($fp)
+J L1329
+NOP
+L1328:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1327
+NOP
+L1329:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1330
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1331
+NOP
+L1330:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1332
+NOP
+L1331:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1332:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1333
+NOP
+SW $t1, 24($fp)
+J L1334
+NOP
+L1333:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1332
+NOP
+L1334:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1335
+NOP
+L1335:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f46_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1338:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1336
+NOP
+SW $t1, 296($fp)
+J L1337
+NOP
+L1336:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1338
+NOP
+L1337:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1339
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1340
+NOP
+L1339:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1341
+NOP
+L1340:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1341:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1342
+NOP
+SW $t1, 248($fp)
+J L1343
+NOP
+L1342:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1341
+NOP
+L1343:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1344
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1345
+NOP
+L1344:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1346
+NOP
+L1345:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1346:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1347
+NOP
+SW $t1, 192($fp)
+J L1348
+NOP
+L1347:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1346
+NOP
+L1348:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1349
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1350
+NOP
+L1349:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1351
+NOP
+L1350:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1351:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1352
+NOP
+SW $t1, 136($fp)
+J L1353
+NOP
+L1352:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1351
+NOP
+L1353:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1354
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1355
+NOP
+L1354:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1356
+NOP
+L1355:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1356:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1357
+NOP
+SW $t1, 80($fp)
+J L1358
+NOP
+L1357:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1356
+NOP
+L1358:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1359
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1360
+NOP
+L1359:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1361
+NOP
+L1360:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1361:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1362
+NOP
+SW $t1, 24($fp)
+J L1363
+NOP
+L1362:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1361
+NOP
+L1363:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1364
+NOP
+L1364:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f47_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1367:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1365
+NOP
+SW $t1, 296($fp)
+J L1366
+NOP
+L1365:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1367
+NOP
+L1366:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1368
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1369
+NOP
+L1368:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1370
+NOP
+L1369:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1370:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1371
+NOP
+SW $t1, 248($fp)
+J L1372
+NOP
+L1371:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1370
+NOP
+L1372:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1373
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1374
+NOP
+L1373:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1375
+NOP
+L1374:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1375:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1376
+NOP
+SW $t1, 192($fp)
+J L1377
+NOP
+L1376:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1375
+NOP
+L1377:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1378
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1379
+NOP
+L1378:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1380
+NOP
+L1379:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1380:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1381
+NOP
+SW $t1, 136($fp)
+J L1382
+NOP
+L1381:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1380
+NOP
+L1382:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1383
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1384
+NOP
+L1383:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1385
+NOP
+L1384:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1385:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1386
+NOP
+SW $t1, 80($fp)
+J L1387
+NOP
+L1386:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1385
+NOP
+L1387:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1388
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1389
+NOP
+L1388:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1390
+NOP
+L1389:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1390:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1391
+NOP
+SW $t1, 24($fp)
+J L1392
+NOP
+L1391:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1390
+NOP
+L1392:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1393
+NOP
+L1393:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f48_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1396:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1394
+NOP
+SW $t1, 296($fp)
+J L1395
+NOP
+L1394:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1396
+NOP
+L1395:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1397
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1398
+NOP
+L1397:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1399
+NOP
+L1398:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1399:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1400
+NOP
+SW $t1, 248($fp)
+J L1401
+NOP
+L1400:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1399
+NOP
+L1401:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1402
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1403
+NOP
+L1402:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1404
+NOP
+L1403:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1404:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1405
+NOP
+SW $t1, 192($fp)
+J L1406
+NOP
+L1405:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1404
+NOP
+L1406:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1407
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1408
+NOP
+L1407:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1409
+NOP
+L1408:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1409:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1410
+NOP
+SW $t1, 136($fp)
+J L1411
+NOP
+L1410:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1409
+NOP
+L1411:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1412
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1413
+NOP
+L1412:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1414
+NOP
+L1413:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1414:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1415
+NOP
+SW $t1, 80($fp)
+J L1416
+NOP
+L1415:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1414
+NOP
+L1416:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1417
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1418
+NOP
+L1417:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1419
+NOP
+L1418:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1419:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1420
+NOP
+SW $t1, 24($fp)
+J L1421
+NOP
+L1420:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1419
+NOP
+L1421:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1422
+NOP
+L1422:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f49_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1425:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1423
+NOP
+SW $t1, 296($fp)
+J L1424
+NOP
+L1423:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1425
+NOP
+L1424:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1426
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1427
+NOP
+L1426:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1428
+NOP
+L1427:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1428:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1429
+NOP
+SW $t1, 248($fp)
+J L1430
+NOP
+L1429:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1428
+NOP
+L1430:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1431
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1432
+NOP
+L1431:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1433
+NOP
+L1432:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1433:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1434
+NOP
+SW $t1, 192($fp)
+J L1435
+NOP
+L1434:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1433
+NOP
+L1435:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1436
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1437
+NOP
+L1436:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1438
+NOP
+L1437:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1438:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1439
+NOP
+SW $t1, 136($fp)
+J L1440
+NOP
+L1439:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1438
+NOP
+L1440:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1441
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1442
+NOP
+L1441:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1443
+NOP
+L1442:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1443:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1444
+NOP
+SW $t1, 80($fp)
+J L1445
+NOP
+L1444:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1443
+NOP
+L1445:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1446
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1447
+NOP
+L1446:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1448
+NOP
+L1447:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1448:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1449
+NOP
+SW $t1, 24($fp)
+J L1450
+NOP
+L1449:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1448
+NOP
+L1450:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1451
+NOP
+L1451:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f50_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1454:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1452
+NOP
+SW $t1, 296($fp)
+J L1453
+NOP
+L1452:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1454
+NOP
+L1453:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1455
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1456
+NOP
+L1455:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1457
+NOP
+L1456:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1457:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1458
+NOP
+SW $t1, 248($fp)
+J L1459
+NOP
+L1458:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1457
+NOP
+L1459:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1460
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1461
+NOP
+L1460:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1462
+NOP
+L1461:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1462:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1463
+NOP
+SW $t1, 192($fp)
+J L1464
+NOP
+L1463:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1462
+NOP
+L1464:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1465
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1466
+NOP
+L1465:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1467
+NOP
+L1466:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1467:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1468
+NOP
+SW $t1, 136($fp)
+J L1469
+NOP
+L1468:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1467
+NOP
+L1469:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1470
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1471
+NOP
+L1470:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1472
+NOP
+L1471:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1472:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1473
+NOP
+SW $t1, 80($fp)
+J L1474
+NOP
+L1473:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1472
+NOP
+L1474:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1475
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1476
+NOP
+L1475:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1477
+NOP
+L1476:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1477:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1478
+NOP
+SW $t1, 24($fp)
+J L1479
+NOP
+L1478:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1477
+NOP
+L1479:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1480
+NOP
+L1480:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f51_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1483:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1481
+NOP
+SW $t1, 296($fp)
+J L1482
+NOP
+L1481:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1483
+NOP
+L1482:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1484
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1485
+NOP
+L1484:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1486
+NOP
+L1485:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1486:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1487
+NOP
+SW $t1, 248($fp)
+J L1488
+NOP
+L1487:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1486
+NOP
+L1488:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1489
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1490
+NOP
+L1489:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1491
+NOP
+L1490:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1491:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1492
+NOP
+SW $t1, 192($fp)
+J L1493
+NOP
+L1492:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1491
+NOP
+L1493:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1494
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1495
+NOP
+L1494:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1496
+NOP
+L1495:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1496:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1497
+NOP
+SW $t1, 136($fp)
+J L1498
+NOP
+L1497:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1496
+NOP
+L1498:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1499
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1500
+NOP
+L1499:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1501
+NOP
+L1500:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1501:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1502
+NOP
+SW $t1, 80($fp)
+J L1503
+NOP
+L1502:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1501
+NOP
+L1503:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1504
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1505
+NOP
+L1504:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1506
+NOP
+L1505:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1506:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1507
+NOP
+SW $t1, 24($fp)
+J L1508
+NOP
+L1507:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1506
+NOP
+L1508:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1509
+NOP
+L1509:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f52_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1512:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1510
+NOP
+SW $t1, 296($fp)
+J L1511
+NOP
+L1510:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1512
+NOP
+L1511:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1513
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1514
+NOP
+L1513:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1515
+NOP
+L1514:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1515:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1516
+NOP
+SW $t1, 248($fp)
+J L1517
+NOP
+L1516:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1515
+NOP
+L1517:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1518
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1519
+NOP
+L1518:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1520
+NOP
+L1519:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1520:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1521
+NOP
+SW $t1, 192($fp)
+J L1522
+NOP
+L1521:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1520
+NOP
+L1522:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1523
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1524
+NOP
+L1523:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1525
+NOP
+L1524:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1525:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1526
+NOP
+SW $t1, 136($fp)
+J L1527
+NOP
+L1526:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1525
+NOP
+L1527:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1528
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1529
+NOP
+L1528:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1530
+NOP
+L1529:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1530:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1531
+NOP
+SW $t1, 80($fp)
+J L1532
+NOP
+L1531:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1530
+NOP
+L1532:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1533
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1534
+NOP
+L1533:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1535
+NOP
+L1534:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1535:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1536
+NOP
+SW $t1, 24($fp)
+J L1537
+NOP
+L1536:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1535
+NOP
+L1537:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1538
+NOP
+L1538:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f53_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1541:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1539
+NOP
+SW $t1, 296($fp)
+J L1540
+NOP
+L1539:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1541
+NOP
+L1540:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1542
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1543
+NOP
+L1542:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1544
+NOP
+L1543:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1544:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1545
+NOP
+SW $t1, 248($fp)
+J L1546
+NOP
+L1545:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1544
+NOP
+L1546:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1547
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1548
+NOP
+L1547:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1549
+NOP
+L1548:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1549:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1550
+NOP
+SW $t1, 192($fp)
+J L1551
+NOP
+L1550:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1549
+NOP
+L1551:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1552
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1553
+NOP
+L1552:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1554
+NOP
+L1553:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1554:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1555
+NOP
+SW $t1, 136($fp)
+J L1556
+NOP
+L1555:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1554
+NOP
+L1556:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1557
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1558
+NOP
+L1557:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1559
+NOP
+L1558:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1559:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1560
+NOP
+SW $t1, 80($fp)
+J L1561
+NOP
+L1560:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1559
+NOP
+L1561:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1562
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1563
+NOP
+L1562:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1564
+NOP
+L1563:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1564:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1565
+NOP
+SW $t1, 24($fp)
+J L1566
+NOP
+L1565:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1564
+NOP
+L1566:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1567
+NOP
+L1567:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f54_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1570:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1568
+NOP
+SW $t1, 296($fp)
+J L1569
+NOP
+L1568:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1570
+NOP
+L1569:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1571
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1572
+NOP
+L1571:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1573
+NOP
+L1572:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1573:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1574
+NOP
+SW $t1, 248($fp)
+J L1575
+NOP
+L1574:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1573
+NOP
+L1575:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1576
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1577
+NOP
+L1576:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1578
+NOP
+L1577:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1578:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1579
+NOP
+SW $t1, 192($fp)
+J L1580
+NOP
+L1579:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1578
+NOP
+L1580:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1581
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1582
+NOP
+L1581:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1583
+NOP
+L1582:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1583:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1584
+NOP
+SW $t1, 136($fp)
+J L1585
+NOP
+L1584:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1583
+NOP
+L1585:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1586
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1587
+NOP
+L1586:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1588
+NOP
+L1587:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1588:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1589
+NOP
+SW $t1, 80($fp)
+J L1590
+NOP
+L1589:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1588
+NOP
+L1590:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1591
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1592
+NOP
+L1591:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1593
+NOP
+L1592:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1593:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1594
+NOP
+SW $t1, 24($fp)
+J L1595
+NOP
+L1594:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1593
+NOP
+L1595:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1596
+NOP
+L1596:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f55_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1599:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1597
+NOP
+SW $t1, 296($fp)
+J L1598
+NOP
+L1597:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1599
+NOP
+L1598:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1600
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1601
+NOP
+L1600:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1602
+NOP
+L1601:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1602:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1603
+NOP
+SW $t1, 248($fp)
+J L1604
+NOP
+L1603:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1602
+NOP
+L1604:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1605
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1606
+NOP
+L1605:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1607
+NOP
+L1606:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1607:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1608
+NOP
+SW $t1, 192($fp)
+J L1609
+NOP
+L1608:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1607
+NOP
+L1609:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1610
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1611
+NOP
+L1610:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1612
+NOP
+L1611:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1612:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1613
+NOP
+SW $t1, 136($fp)
+J L1614
+NOP
+L1613:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1612
+NOP
+L1614:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1615
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1616
+NOP
+L1615:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1617
+NOP
+L1616:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1617:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1618
+NOP
+SW $t1, 80($fp)
+J L1619
+NOP
+L1618:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1617
+NOP
+L1619:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1620
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1621
+NOP
+L1620:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1622
+NOP
+L1621:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1622:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1623
+NOP
+SW $t1, 24($fp)
+J L1624
+NOP
+L1623:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1622
+NOP
+L1624:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1625
+NOP
+L1625:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f56_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1628:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1626
+NOP
+SW $t1, 296($fp)
+J L1627
+NOP
+L1626:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1628
+NOP
+L1627:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1629
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1630
+NOP
+L1629:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1631
+NOP
+L1630:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1631:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1632
+NOP
+SW $t1, 248($fp)
+J L1633
+NOP
+L1632:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1631
+NOP
+L1633:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1634
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1635
+NOP
+L1634:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1636
+NOP
+L1635:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1636:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1637
+NOP
+SW $t1, 192($fp)
+J L1638
+NOP
+L1637:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1636
+NOP
+L1638:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1639
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1640
+NOP
+L1639:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1641
+NOP
+L1640:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1641:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1642
+NOP
+SW $t1, 136($fp)
+J L1643
+NOP
+L1642:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1641
+NOP
+L1643:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1644
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1645
+NOP
+L1644:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1646
+NOP
+L1645:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1646:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1647
+NOP
+SW $t1, 80($fp)
+J L1648
+NOP
+L1647:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1646
+NOP
+L1648:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1649
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1650
+NOP
+L1649:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1651
+NOP
+L1650:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1651:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1652
+NOP
+SW $t1, 24($fp)
+J L1653
+NOP
+L1652:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1651
+NOP
+L1653:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1654
+NOP
+L1654:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f57_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1657:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1655
+NOP
+SW $t1, 296($fp)
+J L1656
+NOP
+L1655:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1657
+NOP
+L1656:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1658
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1659
+NOP
+L1658:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1660
+NOP
+L1659:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1660:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1661
+NOP
+SW $t1, 248($fp)
+J L1662
+NOP
+L1661:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1660
+NOP
+L1662:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1663
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1664
+NOP
+L1663:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1665
+NOP
+L1664:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1665:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1666
+NOP
+SW $t1, 192($fp)
+J L1667
+NOP
+L1666:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1665
+NOP
+L1667:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1668
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1669
+NOP
+L1668:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1670
+NOP
+L1669:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1670:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1671
+NOP
+SW $t1, 136($fp)
+J L1672
+NOP
+L1671:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1670
+NOP
+L1672:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1673
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1674
+NOP
+L1673:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1675
+NOP
+L1674:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1675:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1676
+NOP
+SW $t1, 80($fp)
+J L1677
+NOP
+L1676:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1675
+NOP
+L1677:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1678
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1679
+NOP
+L1678:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1680
+NOP
+L1679:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1680:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1681
+NOP
+SW $t1, 24($fp)
+J L1682
+NOP
+L1681:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1680
+NOP
+L1682:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1683
+NOP
+L1683:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f58_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1686:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1684
+NOP
+SW $t1, 296($fp)
+J L1685
+NOP
+L1684:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1686
+NOP
+L1685:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1687
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1688
+NOP
+L1687:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1689
+NOP
+L1688:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1689:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1690
+NOP
+SW $t1, 248($fp)
+J L1691
+NOP
+L1690:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1689
+NOP
+L1691:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1692
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1693
+NOP
+L1692:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1694
+NOP
+L1693:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1694:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1695
+NOP
+SW $t1, 192($fp)
+J L1696
+NOP
+L1695:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1694
+NOP
+L1696:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1697
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1698
+NOP
+L1697:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1699
+NOP
+L1698:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1699:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1700
+NOP
+SW $t1, 136($fp)
+J L1701
+NOP
+L1700:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1699
+NOP
+L1701:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1702
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1703
+NOP
+L1702:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1704
+NOP
+L1703:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1704:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1705
+NOP
+SW $t1, 80($fp)
+J L1706
+NOP
+L1705:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1704
+NOP
+L1706:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1707
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1708
+NOP
+L1707:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1709
+NOP
+L1708:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1709:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1710
+NOP
+SW $t1, 24($fp)
+J L1711
+NOP
+L1710:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1709
+NOP
+L1711:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1712
+NOP
+L1712:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f59_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1715:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1713
+NOP
+SW $t1, 296($fp)
+J L1714
+NOP
+L1713:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1715
+NOP
+L1714:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1716
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1717
+NOP
+L1716:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1718
+NOP
+L1717:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1718:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1719
+NOP
+SW $t1, 248($fp)
+J L1720
+NOP
+L1719:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1718
+NOP
+L1720:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1721
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1722
+NOP
+L1721:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1723
+NOP
+L1722:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1723:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1724
+NOP
+SW $t1, 192($fp)
+J L1725
+NOP
+L1724:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1723
+NOP
+L1725:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1726
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1727
+NOP
+L1726:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1728
+NOP
+L1727:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1728:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1729
+NOP
+SW $t1, 136($fp)
+J L1730
+NOP
+L1729:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1728
+NOP
+L1730:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1731
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1732
+NOP
+L1731:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1733
+NOP
+L1732:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1733:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1734
+NOP
+SW $t1, 80($fp)
+J L1735
+NOP
+L1734:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1733
+NOP
+L1735:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1736
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1737
+NOP
+L1736:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1738
+NOP
+L1737:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1738:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1739
+NOP
+SW $t1, 24($fp)
+J L1740
+NOP
+L1739:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1738
+NOP
+L1740:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1741
+NOP
+L1741:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f60_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1744:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1742
+NOP
+SW $t1, 296($fp)
+J L1743
+NOP
+L1742:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1744
+NOP
+L1743:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1745
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1746
+NOP
+L1745:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1747
+NOP
+L1746:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1747:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1748
+NOP
+SW $t1, 248($fp)
+J L1749
+NOP
+L1748:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1747
+NOP
+L1749:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1750
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1751
+NOP
+L1750:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1752
+NOP
+L1751:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1752:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1753
+NOP
+SW $t1, 192($fp)
+J L1754
+NOP
+L1753:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1752
+NOP
+L1754:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1755
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1756
+NOP
+L1755:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1757
+NOP
+L1756:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1757:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1758
+NOP
+SW $t1, 136($fp)
+J L1759
+NOP
+L1758:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1757
+NOP
+L1759:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1760
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1761
+NOP
+L1760:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1762
+NOP
+L1761:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1762:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1763
+NOP
+SW $t1, 80($fp)
+J L1764
+NOP
+L1763:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1762
+NOP
+L1764:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1765
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1766
+NOP
+L1765:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1767
+NOP
+L1766:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1767:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1768
+NOP
+SW $t1, 24($fp)
+J L1769
+NOP
+L1768:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1767
+NOP
+L1769:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1770
+NOP
+L1770:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f61_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1773:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1771
+NOP
+SW $t1, 296($fp)
+J L1772
+NOP
+L1771:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1773
+NOP
+L1772:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1774
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1775
+NOP
+L1774:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1776
+NOP
+L1775:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1776:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1777
+NOP
+SW $t1, 248($fp)
+J L1778
+NOP
+L1777:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1776
+NOP
+L1778:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1779
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1780
+NOP
+L1779:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1781
+NOP
+L1780:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1781:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1782
+NOP
+SW $t1, 192($fp)
+J L1783
+NOP
+L1782:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1781
+NOP
+L1783:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1784
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1785
+NOP
+L1784:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1786
+NOP
+L1785:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1786:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1787
+NOP
+SW $t1, 136($fp)
+J L1788
+NOP
+L1787:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1786
+NOP
+L1788:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1789
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1790
+NOP
+L1789:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1791
+NOP
+L1790:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1791:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1792
+NOP
+SW $t1, 80($fp)
+J L1793
+NOP
+L1792:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1791
+NOP
+L1793:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1794
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1795
+NOP
+L1794:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1796
+NOP
+L1795:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1796:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1797
+NOP
+SW $t1, 24($fp)
+J L1798
+NOP
+L1797:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1796
+NOP
+L1798:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1799
+NOP
+L1799:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f62_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1802:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1800
+NOP
+SW $t1, 296($fp)
+J L1801
+NOP
+L1800:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1802
+NOP
+L1801:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1803
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1804
+NOP
+L1803:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1805
+NOP
+L1804:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1805:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1806
+NOP
+SW $t1, 248($fp)
+J L1807
+NOP
+L1806:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1805
+NOP
+L1807:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1808
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1809
+NOP
+L1808:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1810
+NOP
+L1809:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1810:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1811
+NOP
+SW $t1, 192($fp)
+J L1812
+NOP
+L1811:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1810
+NOP
+L1812:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1813
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1814
+NOP
+L1813:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1815
+NOP
+L1814:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1815:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1816
+NOP
+SW $t1, 136($fp)
+J L1817
+NOP
+L1816:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1815
+NOP
+L1817:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1818
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1819
+NOP
+L1818:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1820
+NOP
+L1819:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1820:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1821
+NOP
+SW $t1, 80($fp)
+J L1822
+NOP
+L1821:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1820
+NOP
+L1822:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1823
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1824
+NOP
+L1823:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1825
+NOP
+L1824:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1825:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1826
+NOP
+SW $t1, 24($fp)
+J L1827
+NOP
+L1826:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1825
+NOP
+L1827:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1828
+NOP
+L1828:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f63_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1831:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1829
+NOP
+SW $t1, 296($fp)
+J L1830
+NOP
+L1829:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1831
+NOP
+L1830:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1832
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1833
+NOP
+L1832:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1834
+NOP
+L1833:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1834:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1835
+NOP
+SW $t1, 248($fp)
+J L1836
+NOP
+L1835:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1834
+NOP
+L1836:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1837
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1838
+NOP
+L1837:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1839
+NOP
+L1838:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1839:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1840
+NOP
+SW $t1, 192($fp)
+J L1841
+NOP
+L1840:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1839
+NOP
+L1841:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1842
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1843
+NOP
+L1842:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1844
+NOP
+L1843:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1844:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1845
+NOP
+SW $t1, 136($fp)
+J L1846
+NOP
+L1845:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1844
+NOP
+L1846:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1847
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1848
+NOP
+L1847:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1849
+NOP
+L1848:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1849:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1850
+NOP
+SW $t1, 80($fp)
+J L1851
+NOP
+L1850:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1849
+NOP
+L1851:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1852
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1853
+NOP
+L1852:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1854
+NOP
+L1853:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1854:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1855
+NOP
+SW $t1, 24($fp)
+J L1856
+NOP
+L1855:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1854
+NOP
+L1856:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1857
+NOP
+L1857:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f64_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1860:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1858
+NOP
+SW $t1, 296($fp)
+J L1859
+NOP
+L1858:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1860
+NOP
+L1859:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1861
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1862
+NOP
+L1861:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1863
+NOP
+L1862:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1863:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1864
+NOP
+SW $t1, 248($fp)
+J L1865
+NOP
+L1864:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1863
+NOP
+L1865:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1866
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1867
+NOP
+L1866:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1868
+NOP
+L1867:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1868:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1869
+NOP
+SW $t1, 192($fp)
+J L1870
+NOP
+L1869:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1868
+NOP
+L1870:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1871
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1872
+NOP
+L1871:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1873
+NOP
+L1872:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1873:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1874
+NOP
+SW $t1, 136($fp)
+J L1875
+NOP
+L1874:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1873
+NOP
+L1875:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1876
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1877
+NOP
+L1876:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1878
+NOP
+L1877:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1878:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1879
+NOP
+SW $t1, 80($fp)
+J L1880
+NOP
+L1879:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1878
+NOP
+L1880:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1881
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1882
+NOP
+L1881:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1883
+NOP
+L1882:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1883:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1884
+NOP
+SW $t1, 24($fp)
+J L1885
+NOP
+L1884:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1883
+NOP
+L1885:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1886
+NOP
+L1886:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f65_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1889:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1887
+NOP
+SW $t1, 296($fp)
+J L1888
+NOP
+L1887:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1889
+NOP
+L1888:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1890
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1891
+NOP
+L1890:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1892
+NOP
+L1891:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1892:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1893
+NOP
+SW $t1, 248($fp)
+J L1894
+NOP
+L1893:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1892
+NOP
+L1894:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1895
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1896
+NOP
+L1895:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1897
+NOP
+L1896:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1897:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1898
+NOP
+SW $t1, 192($fp)
+J L1899
+NOP
+L1898:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1897
+NOP
+L1899:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1900
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1901
+NOP
+L1900:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1902
+NOP
+L1901:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1902:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1903
+NOP
+SW $t1, 136($fp)
+J L1904
+NOP
+L1903:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1902
+NOP
+L1904:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1905
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1906
+NOP
+L1905:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1907
+NOP
+L1906:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1907:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1908
+NOP
+SW $t1, 80($fp)
+J L1909
+NOP
+L1908:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1907
+NOP
+L1909:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1910
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1911
+NOP
+L1910:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1912
+NOP
+L1911:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1912:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1913
+NOP
+SW $t1, 24($fp)
+J L1914
+NOP
+L1913:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1912
+NOP
+L1914:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1915
+NOP
+L1915:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f66_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1918:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1916
+NOP
+SW $t1, 296($fp)
+J L1917
+NOP
+L1916:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1918
+NOP
+L1917:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1919
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1920
+NOP
+L1919:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1921
+NOP
+L1920:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1921:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1922
+NOP
+SW $t1, 248($fp)
+J L1923
+NOP
+L1922:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1921
+NOP
+L1923:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1924
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1925
+NOP
+L1924:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1926
+NOP
+L1925:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1926:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1927
+NOP
+SW $t1, 192($fp)
+J L1928
+NOP
+L1927:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1926
+NOP
+L1928:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1929
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1930
+NOP
+L1929:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1931
+NOP
+L1930:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1931:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1932
+NOP
+SW $t1, 136($fp)
+J L1933
+NOP
+L1932:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1931
+NOP
+L1933:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1934
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1935
+NOP
+L1934:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1936
+NOP
+L1935:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1936:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1937
+NOP
+SW $t1, 80($fp)
+J L1938
+NOP
+L1937:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1936
+NOP
+L1938:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1939
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1940
+NOP
+L1939:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1941
+NOP
+L1940:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1941:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1942
+NOP
+SW $t1, 24($fp)
+J L1943
+NOP
+L1942:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1941
+NOP
+L1943:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1944
+NOP
+L1944:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f67_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1947:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1945
+NOP
+SW $t1, 296($fp)
+J L1946
+NOP
+L1945:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1947
+NOP
+L1946:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1948
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1949
+NOP
+L1948:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1950
+NOP
+L1949:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1950:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1951
+NOP
+SW $t1, 248($fp)
+J L1952
+NOP
+L1951:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1950
+NOP
+L1952:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1953
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1954
+NOP
+L1953:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1955
+NOP
+L1954:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1955:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1956
+NOP
+SW $t1, 192($fp)
+J L1957
+NOP
+L1956:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1955
+NOP
+L1957:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1958
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1959
+NOP
+L1958:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1960
+NOP
+L1959:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1960:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1961
+NOP
+SW $t1, 136($fp)
+J L1962
+NOP
+L1961:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1960
+NOP
+L1962:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1963
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1964
+NOP
+L1963:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1965
+NOP
+L1964:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1965:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1966
+NOP
+SW $t1, 80($fp)
+J L1967
+NOP
+L1966:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1965
+NOP
+L1967:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1968
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1969
+NOP
+L1968:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1970
+NOP
+L1969:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1970:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1971
+NOP
+SW $t1, 24($fp)
+J L1972
+NOP
+L1971:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1970
+NOP
+L1972:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L1973
+NOP
+L1973:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f68_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L1976:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L1974
+NOP
+SW $t1, 296($fp)
+J L1975
+NOP
+L1974:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L1976
+NOP
+L1975:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L1977
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L1978
+NOP
+L1977:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L1979
+NOP
+L1978:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L1979:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1980
+NOP
+SW $t1, 248($fp)
+J L1981
+NOP
+L1980:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L1979
+NOP
+L1981:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1982
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L1983
+NOP
+L1982:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L1984
+NOP
+L1983:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L1984:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1985
+NOP
+SW $t1, 192($fp)
+J L1986
+NOP
+L1985:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L1984
+NOP
+L1986:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1987
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L1988
+NOP
+L1987:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L1989
+NOP
+L1988:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L1989:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1990
+NOP
+SW $t1, 136($fp)
+J L1991
+NOP
+L1990:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L1989
+NOP
+L1991:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1992
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L1993
+NOP
+L1992:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L1994
+NOP
+L1993:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L1994:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L1995
+NOP
+SW $t1, 80($fp)
+J L1996
+NOP
+L1995:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L1994
+NOP
+L1996:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L1997
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L1998
+NOP
+L1997:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L1999
+NOP
+L1998:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L1999:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2000
+NOP
+SW $t1, 24($fp)
+J L2001
+NOP
+L2000:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L1999
+NOP
+L2001:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2002
+NOP
+L2002:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f69_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2005:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2003
+NOP
+SW $t1, 296($fp)
+J L2004
+NOP
+L2003:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2005
+NOP
+L2004:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2006
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2007
+NOP
+L2006:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2008
+NOP
+L2007:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2008:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2009
+NOP
+SW $t1, 248($fp)
+J L2010
+NOP
+L2009:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2008
+NOP
+L2010:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2011
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2012
+NOP
+L2011:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2013
+NOP
+L2012:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2013:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2014
+NOP
+SW $t1, 192($fp)
+J L2015
+NOP
+L2014:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2013
+NOP
+L2015:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2016
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2017
+NOP
+L2016:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2018
+NOP
+L2017:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2018:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2019
+NOP
+SW $t1, 136($fp)
+J L2020
+NOP
+L2019:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2018
+NOP
+L2020:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2021
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2022
+NOP
+L2021:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2023
+NOP
+L2022:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2023:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2024
+NOP
+SW $t1, 80($fp)
+J L2025
+NOP
+L2024:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2023
+NOP
+L2025:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2026
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2027
+NOP
+L2026:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2028
+NOP
+L2027:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2028:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2029
+NOP
+SW $t1, 24($fp)
+J L2030
+NOP
+L2029:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2028
+NOP
+L2030:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2031
+NOP
+L2031:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f70_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2034:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2032
+NOP
+SW $t1, 296($fp)
+J L2033
+NOP
+L2032:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2034
+NOP
+L2033:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2035
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2036
+NOP
+L2035:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2037
+NOP
+L2036:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2037:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2038
+NOP
+SW $t1, 248($fp)
+J L2039
+NOP
+L2038:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2037
+NOP
+L2039:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2040
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2041
+NOP
+L2040:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2042
+NOP
+L2041:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2042:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2043
+NOP
+SW $t1, 192($fp)
+J L2044
+NOP
+L2043:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2042
+NOP
+L2044:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2045
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2046
+NOP
+L2045:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2047
+NOP
+L2046:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2047:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2048
+NOP
+SW $t1, 136($fp)
+J L2049
+NOP
+L2048:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2047
+NOP
+L2049:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2050
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2051
+NOP
+L2050:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2052
+NOP
+L2051:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2052:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2053
+NOP
+SW $t1, 80($fp)
+J L2054
+NOP
+L2053:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2052
+NOP
+L2054:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2055
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2056
+NOP
+L2055:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2057
+NOP
+L2056:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2057:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2058
+NOP
+SW $t1, 24($fp)
+J L2059
+NOP
+L2058:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2057
+NOP
+L2059:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2060
+NOP
+L2060:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f71_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2063:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2061
+NOP
+SW $t1, 296($fp)
+J L2062
+NOP
+L2061:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2063
+NOP
+L2062:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2064
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2065
+NOP
+L2064:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2066
+NOP
+L2065:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2066:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2067
+NOP
+SW $t1, 248($fp)
+J L2068
+NOP
+L2067:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2066
+NOP
+L2068:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2069
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2070
+NOP
+L2069:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2071
+NOP
+L2070:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2071:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2072
+NOP
+SW $t1, 192($fp)
+J L2073
+NOP
+L2072:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2071
+NOP
+L2073:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2074
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2075
+NOP
+L2074:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2076
+NOP
+L2075:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2076:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2077
+NOP
+SW $t1, 136($fp)
+J L2078
+NOP
+L2077:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2076
+NOP
+L2078:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2079
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2080
+NOP
+L2079:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2081
+NOP
+L2080:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2081:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2082
+NOP
+SW $t1, 80($fp)
+J L2083
+NOP
+L2082:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2081
+NOP
+L2083:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2084
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2085
+NOP
+L2084:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2086
+NOP
+L2085:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2086:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2087
+NOP
+SW $t1, 24($fp)
+J L2088
+NOP
+L2087:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2086
+NOP
+L2088:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2089
+NOP
+L2089:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f72_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2092:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2090
+NOP
+SW $t1, 296($fp)
+J L2091
+NOP
+L2090:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2092
+NOP
+L2091:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2093
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2094
+NOP
+L2093:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2095
+NOP
+L2094:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2095:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2096
+NOP
+SW $t1, 248($fp)
+J L2097
+NOP
+L2096:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2095
+NOP
+L2097:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2098
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2099
+NOP
+L2098:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2100
+NOP
+L2099:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2100:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2101
+NOP
+SW $t1, 192($fp)
+J L2102
+NOP
+L2101:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2100
+NOP
+L2102:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2103
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2104
+NOP
+L2103:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2105
+NOP
+L2104:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2105:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2106
+NOP
+SW $t1, 136($fp)
+J L2107
+NOP
+L2106:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2105
+NOP
+L2107:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2108
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2109
+NOP
+L2108:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2110
+NOP
+L2109:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2110:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2111
+NOP
+SW $t1, 80($fp)
+J L2112
+NOP
+L2111:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2110
+NOP
+L2112:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2113
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2114
+NOP
+L2113:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2115
+NOP
+L2114:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2115:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2116
+NOP
+SW $t1, 24($fp)
+J L2117
+NOP
+L2116:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2115
+NOP
+L2117:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2118
+NOP
+L2118:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f73_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2121:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2119
+NOP
+SW $t1, 296($fp)
+J L2120
+NOP
+L2119:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2121
+NOP
+L2120:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2122
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2123
+NOP
+L2122:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2124
+NOP
+L2123:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2124:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2125
+NOP
+SW $t1, 248($fp)
+J L2126
+NOP
+L2125:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2124
+NOP
+L2126:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2127
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2128
+NOP
+L2127:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2129
+NOP
+L2128:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2129:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2130
+NOP
+SW $t1, 192($fp)
+J L2131
+NOP
+L2130:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2129
+NOP
+L2131:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2132
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2133
+NOP
+L2132:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2134
+NOP
+L2133:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2134:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2135
+NOP
+SW $t1, 136($fp)
+J L2136
+NOP
+L2135:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2134
+NOP
+L2136:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2137
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2138
+NOP
+L2137:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2139
+NOP
+L2138:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2139:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2140
+NOP
+SW $t1, 80($fp)
+J L2141
+NOP
+L2140:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2139
+NOP
+L2141:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2142
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2143
+NOP
+L2142:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2144
+NOP
+L2143:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2144:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2145
+NOP
+SW $t1, 24($fp)
+J L2146
+NOP
+L2145:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2144
+NOP
+L2146:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2147
+NOP
+L2147:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f74_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2150:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2148
+NOP
+SW $t1, 296($fp)
+J L2149
+NOP
+L2148:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2150
+NOP
+L2149:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2151
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2152
+NOP
+L2151:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2153
+NOP
+L2152:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2153:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2154
+NOP
+SW $t1, 248($fp)
+J L2155
+NOP
+L2154:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2153
+NOP
+L2155:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2156
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2157
+NOP
+L2156:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2158
+NOP
+L2157:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2158:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2159
+NOP
+SW $t1, 192($fp)
+J L2160
+NOP
+L2159:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2158
+NOP
+L2160:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2161
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2162
+NOP
+L2161:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2163
+NOP
+L2162:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2163:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2164
+NOP
+SW $t1, 136($fp)
+J L2165
+NOP
+L2164:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2163
+NOP
+L2165:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2166
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2167
+NOP
+L2166:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2168
+NOP
+L2167:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2168:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2169
+NOP
+SW $t1, 80($fp)
+J L2170
+NOP
+L2169:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2168
+NOP
+L2170:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2171
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2172
+NOP
+L2171:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2173
+NOP
+L2172:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2173:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2174
+NOP
+SW $t1, 24($fp)
+J L2175
+NOP
+L2174:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2173
+NOP
+L2175:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2176
+NOP
+L2176:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f75_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2179:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2177
+NOP
+SW $t1, 296($fp)
+J L2178
+NOP
+L2177:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2179
+NOP
+L2178:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2180
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2181
+NOP
+L2180:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2182
+NOP
+L2181:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2182:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2183
+NOP
+SW $t1, 248($fp)
+J L2184
+NOP
+L2183:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2182
+NOP
+L2184:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2185
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2186
+NOP
+L2185:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2187
+NOP
+L2186:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2187:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2188
+NOP
+SW $t1, 192($fp)
+J L2189
+NOP
+L2188:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2187
+NOP
+L2189:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2190
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2191
+NOP
+L2190:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2192
+NOP
+L2191:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2192:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2193
+NOP
+SW $t1, 136($fp)
+J L2194
+NOP
+L2193:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2192
+NOP
+L2194:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2195
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2196
+NOP
+L2195:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2197
+NOP
+L2196:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2197:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2198
+NOP
+SW $t1, 80($fp)
+J L2199
+NOP
+L2198:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2197
+NOP
+L2199:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2200
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2201
+NOP
+L2200:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2202
+NOP
+L2201:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2202:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2203
+NOP
+SW $t1, 24($fp)
+J L2204
+NOP
+L2203:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2202
+NOP
+L2204:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2205
+NOP
+L2205:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f76_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2208:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2206
+NOP
+SW $t1, 296($fp)
+J L2207
+NOP
+L2206:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2208
+NOP
+L2207:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2209
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2210
+NOP
+L2209:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2211
+NOP
+L2210:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2211:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2212
+NOP
+SW $t1, 248($fp)
+J L2213
+NOP
+L2212:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2211
+NOP
+L2213:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2214
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2215
+NOP
+L2214:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2216
+NOP
+L2215:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2216:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2217
+NOP
+SW $t1, 192($fp)
+J L2218
+NOP
+L2217:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2216
+NOP
+L2218:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2219
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2220
+NOP
+L2219:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2221
+NOP
+L2220:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2221:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2222
+NOP
+SW $t1, 136($fp)
+J L2223
+NOP
+L2222:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2221
+NOP
+L2223:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2224
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2225
+NOP
+L2224:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2226
+NOP
+L2225:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2226:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2227
+NOP
+SW $t1, 80($fp)
+J L2228
+NOP
+L2227:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2226
+NOP
+L2228:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2229
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2230
+NOP
+L2229:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2231
+NOP
+L2230:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2231:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2232
+NOP
+SW $t1, 24($fp)
+J L2233
+NOP
+L2232:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2231
+NOP
+L2233:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2234
+NOP
+L2234:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f77_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2237:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2235
+NOP
+SW $t1, 296($fp)
+J L2236
+NOP
+L2235:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2237
+NOP
+L2236:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2238
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2239
+NOP
+L2238:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2240
+NOP
+L2239:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2240:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2241
+NOP
+SW $t1, 248($fp)
+J L2242
+NOP
+L2241:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2240
+NOP
+L2242:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2243
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2244
+NOP
+L2243:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2245
+NOP
+L2244:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2245:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2246
+NOP
+SW $t1, 192($fp)
+J L2247
+NOP
+L2246:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2245
+NOP
+L2247:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2248
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2249
+NOP
+L2248:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2250
+NOP
+L2249:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2250:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2251
+NOP
+SW $t1, 136($fp)
+J L2252
+NOP
+L2251:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2250
+NOP
+L2252:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2253
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2254
+NOP
+L2253:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2255
+NOP
+L2254:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2255:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2256
+NOP
+SW $t1, 80($fp)
+J L2257
+NOP
+L2256:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2255
+NOP
+L2257:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2258
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2259
+NOP
+L2258:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2260
+NOP
+L2259:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2260:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2261
+NOP
+SW $t1, 24($fp)
+J L2262
+NOP
+L2261:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2260
+NOP
+L2262:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2263
+NOP
+L2263:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f78_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2266:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2264
+NOP
+SW $t1, 296($fp)
+J L2265
+NOP
+L2264:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2266
+NOP
+L2265:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2267
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2268
+NOP
+L2267:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2269
+NOP
+L2268:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2269:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2270
+NOP
+SW $t1, 248($fp)
+J L2271
+NOP
+L2270:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2269
+NOP
+L2271:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2272
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2273
+NOP
+L2272:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2274
+NOP
+L2273:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2274:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2275
+NOP
+SW $t1, 192($fp)
+J L2276
+NOP
+L2275:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2274
+NOP
+L2276:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2277
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2278
+NOP
+L2277:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2279
+NOP
+L2278:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2279:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2280
+NOP
+SW $t1, 136($fp)
+J L2281
+NOP
+L2280:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2279
+NOP
+L2281:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2282
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2283
+NOP
+L2282:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2284
+NOP
+L2283:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2284:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2285
+NOP
+SW $t1, 80($fp)
+J L2286
+NOP
+L2285:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2284
+NOP
+L2286:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2287
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2288
+NOP
+L2287:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2289
+NOP
+L2288:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2289:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2290
+NOP
+SW $t1, 24($fp)
+J L2291
+NOP
+L2290:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2289
+NOP
+L2291:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2292
+NOP
+L2292:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f79_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2295:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2293
+NOP
+SW $t1, 296($fp)
+J L2294
+NOP
+L2293:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2295
+NOP
+L2294:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2296
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2297
+NOP
+L2296:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2298
+NOP
+L2297:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2298:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2299
+NOP
+SW $t1, 248($fp)
+J L2300
+NOP
+L2299:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2298
+NOP
+L2300:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2301
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2302
+NOP
+L2301:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2303
+NOP
+L2302:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2303:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2304
+NOP
+SW $t1, 192($fp)
+J L2305
+NOP
+L2304:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2303
+NOP
+L2305:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2306
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2307
+NOP
+L2306:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2308
+NOP
+L2307:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2308:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2309
+NOP
+SW $t1, 136($fp)
+J L2310
+NOP
+L2309:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2308
+NOP
+L2310:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2311
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2312
+NOP
+L2311:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2313
+NOP
+L2312:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2313:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2314
+NOP
+SW $t1, 80($fp)
+J L2315
+NOP
+L2314:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2313
+NOP
+L2315:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2316
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2317
+NOP
+L2316:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2318
+NOP
+L2317:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2318:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2319
+NOP
+SW $t1, 24($fp)
+J L2320
+NOP
+L2319:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2318
+NOP
+L2320:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2321
+NOP
+L2321:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f80_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2324:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2322
+NOP
+SW $t1, 296($fp)
+J L2323
+NOP
+L2322:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2324
+NOP
+L2323:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2325
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2326
+NOP
+L2325:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2327
+NOP
+L2326:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2327:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2328
+NOP
+SW $t1, 248($fp)
+J L2329
+NOP
+L2328:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2327
+NOP
+L2329:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2330
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2331
+NOP
+L2330:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2332
+NOP
+L2331:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2332:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2333
+NOP
+SW $t1, 192($fp)
+J L2334
+NOP
+L2333:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2332
+NOP
+L2334:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2335
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2336
+NOP
+L2335:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2337
+NOP
+L2336:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2337:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2338
+NOP
+SW $t1, 136($fp)
+J L2339
+NOP
+L2338:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2337
+NOP
+L2339:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2340
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2341
+NOP
+L2340:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2342
+NOP
+L2341:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2342:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2343
+NOP
+SW $t1, 80($fp)
+J L2344
+NOP
+L2343:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2342
+NOP
+L2344:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2345
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2346
+NOP
+L2345:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2347
+NOP
+L2346:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2347:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2348
+NOP
+SW $t1, 24($fp)
+J L2349
+NOP
+L2348:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2347
+NOP
+L2349:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2350
+NOP
+L2350:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f81_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2353:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2351
+NOP
+SW $t1, 296($fp)
+J L2352
+NOP
+L2351:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2353
+NOP
+L2352:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2354
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2355
+NOP
+L2354:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2356
+NOP
+L2355:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2356:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2357
+NOP
+SW $t1, 248($fp)
+J L2358
+NOP
+L2357:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2356
+NOP
+L2358:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2359
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2360
+NOP
+L2359:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2361
+NOP
+L2360:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2361:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2362
+NOP
+SW $t1, 192($fp)
+J L2363
+NOP
+L2362:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2361
+NOP
+L2363:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2364
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2365
+NOP
+L2364:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2366
+NOP
+L2365:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2366:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2367
+NOP
+SW $t1, 136($fp)
+J L2368
+NOP
+L2367:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2366
+NOP
+L2368:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2369
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2370
+NOP
+L2369:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2371
+NOP
+L2370:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2371:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2372
+NOP
+SW $t1, 80($fp)
+J L2373
+NOP
+L2372:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2371
+NOP
+L2373:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2374
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2375
+NOP
+L2374:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2376
+NOP
+L2375:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2376:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2377
+NOP
+SW $t1, 24($fp)
+J L2378
+NOP
+L2377:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2376
+NOP
+L2378:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2379
+NOP
+L2379:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f82_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2382:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2380
+NOP
+SW $t1, 296($fp)
+J L2381
+NOP
+L2380:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2382
+NOP
+L2381:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2383
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2384
+NOP
+L2383:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2385
+NOP
+L2384:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2385:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2386
+NOP
+SW $t1, 248($fp)
+J L2387
+NOP
+L2386:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2385
+NOP
+L2387:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2388
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2389
+NOP
+L2388:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2390
+NOP
+L2389:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2390:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2391
+NOP
+SW $t1, 192($fp)
+J L2392
+NOP
+L2391:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2390
+NOP
+L2392:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2393
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2394
+NOP
+L2393:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2395
+NOP
+L2394:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2395:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2396
+NOP
+SW $t1, 136($fp)
+J L2397
+NOP
+L2396:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2395
+NOP
+L2397:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2398
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2399
+NOP
+L2398:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2400
+NOP
+L2399:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2400:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2401
+NOP
+SW $t1, 80($fp)
+J L2402
+NOP
+L2401:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2400
+NOP
+L2402:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2403
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2404
+NOP
+L2403:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2405
+NOP
+L2404:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2405:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2406
+NOP
+SW $t1, 24($fp)
+J L2407
+NOP
+L2406:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2405
+NOP
+L2407:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2408
+NOP
+L2408:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f83_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2411:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2409
+NOP
+SW $t1, 296($fp)
+J L2410
+NOP
+L2409:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2411
+NOP
+L2410:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2412
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2413
+NOP
+L2412:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2414
+NOP
+L2413:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2414:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2415
+NOP
+SW $t1, 248($fp)
+J L2416
+NOP
+L2415:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2414
+NOP
+L2416:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2417
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2418
+NOP
+L2417:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2419
+NOP
+L2418:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2419:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2420
+NOP
+SW $t1, 192($fp)
+J L2421
+NOP
+L2420:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2419
+NOP
+L2421:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2422
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2423
+NOP
+L2422:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2424
+NOP
+L2423:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2424:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2425
+NOP
+SW $t1, 136($fp)
+J L2426
+NOP
+L2425:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2424
+NOP
+L2426:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2427
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2428
+NOP
+L2427:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2429
+NOP
+L2428:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2429:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2430
+NOP
+SW $t1, 80($fp)
+J L2431
+NOP
+L2430:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2429
+NOP
+L2431:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2432
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2433
+NOP
+L2432:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2434
+NOP
+L2433:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2434:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2435
+NOP
+SW $t1, 24($fp)
+J L2436
+NOP
+L2435:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2434
+NOP
+L2436:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2437
+NOP
+L2437:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f84_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2440:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2438
+NOP
+SW $t1, 296($fp)
+J L2439
+NOP
+L2438:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2440
+NOP
+L2439:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2441
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2442
+NOP
+L2441:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2443
+NOP
+L2442:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2443:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2444
+NOP
+SW $t1, 248($fp)
+J L2445
+NOP
+L2444:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2443
+NOP
+L2445:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2446
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2447
+NOP
+L2446:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2448
+NOP
+L2447:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2448:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2449
+NOP
+SW $t1, 192($fp)
+J L2450
+NOP
+L2449:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2448
+NOP
+L2450:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2451
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2452
+NOP
+L2451:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2453
+NOP
+L2452:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2453:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2454
+NOP
+SW $t1, 136($fp)
+J L2455
+NOP
+L2454:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2453
+NOP
+L2455:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2456
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2457
+NOP
+L2456:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2458
+NOP
+L2457:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2458:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2459
+NOP
+SW $t1, 80($fp)
+J L2460
+NOP
+L2459:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2458
+NOP
+L2460:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2461
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2462
+NOP
+L2461:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2463
+NOP
+L2462:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2463:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2464
+NOP
+SW $t1, 24($fp)
+J L2465
+NOP
+L2464:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2463
+NOP
+L2465:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2466
+NOP
+L2466:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f85_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2469:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2467
+NOP
+SW $t1, 296($fp)
+J L2468
+NOP
+L2467:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2469
+NOP
+L2468:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2470
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2471
+NOP
+L2470:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2472
+NOP
+L2471:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2472:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2473
+NOP
+SW $t1, 248($fp)
+J L2474
+NOP
+L2473:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2472
+NOP
+L2474:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2475
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2476
+NOP
+L2475:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2477
+NOP
+L2476:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2477:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2478
+NOP
+SW $t1, 192($fp)
+J L2479
+NOP
+L2478:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2477
+NOP
+L2479:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2480
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2481
+NOP
+L2480:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2482
+NOP
+L2481:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2482:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2483
+NOP
+SW $t1, 136($fp)
+J L2484
+NOP
+L2483:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2482
+NOP
+L2484:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2485
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2486
+NOP
+L2485:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2487
+NOP
+L2486:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2487:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2488
+NOP
+SW $t1, 80($fp)
+J L2489
+NOP
+L2488:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2487
+NOP
+L2489:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2490
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2491
+NOP
+L2490:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2492
+NOP
+L2491:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2492:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2493
+NOP
+SW $t1, 24($fp)
+J L2494
+NOP
+L2493:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2492
+NOP
+L2494:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2495
+NOP
+L2495:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f86_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2498:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2496
+NOP
+SW $t1, 296($fp)
+J L2497
+NOP
+L2496:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2498
+NOP
+L2497:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2499
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2500
+NOP
+L2499:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2501
+NOP
+L2500:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2501:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2502
+NOP
+SW $t1, 248($fp)
+J L2503
+NOP
+L2502:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2501
+NOP
+L2503:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2504
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2505
+NOP
+L2504:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2506
+NOP
+L2505:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2506:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2507
+NOP
+SW $t1, 192($fp)
+J L2508
+NOP
+L2507:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2506
+NOP
+L2508:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2509
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2510
+NOP
+L2509:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2511
+NOP
+L2510:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2511:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2512
+NOP
+SW $t1, 136($fp)
+J L2513
+NOP
+L2512:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2511
+NOP
+L2513:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2514
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2515
+NOP
+L2514:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2516
+NOP
+L2515:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2516:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2517
+NOP
+SW $t1, 80($fp)
+J L2518
+NOP
+L2517:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2516
+NOP
+L2518:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2519
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2520
+NOP
+L2519:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2521
+NOP
+L2520:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2521:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2522
+NOP
+SW $t1, 24($fp)
+J L2523
+NOP
+L2522:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2521
+NOP
+L2523:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2524
+NOP
+L2524:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f87_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2527:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2525
+NOP
+SW $t1, 296($fp)
+J L2526
+NOP
+L2525:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2527
+NOP
+L2526:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2528
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2529
+NOP
+L2528:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2530
+NOP
+L2529:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2530:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2531
+NOP
+SW $t1, 248($fp)
+J L2532
+NOP
+L2531:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2530
+NOP
+L2532:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2533
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2534
+NOP
+L2533:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2535
+NOP
+L2534:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2535:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2536
+NOP
+SW $t1, 192($fp)
+J L2537
+NOP
+L2536:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2535
+NOP
+L2537:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2538
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2539
+NOP
+L2538:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2540
+NOP
+L2539:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2540:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2541
+NOP
+SW $t1, 136($fp)
+J L2542
+NOP
+L2541:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2540
+NOP
+L2542:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2543
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2544
+NOP
+L2543:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2545
+NOP
+L2544:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2545:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2546
+NOP
+SW $t1, 80($fp)
+J L2547
+NOP
+L2546:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2545
+NOP
+L2547:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2548
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2549
+NOP
+L2548:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2550
+NOP
+L2549:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2550:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2551
+NOP
+SW $t1, 24($fp)
+J L2552
+NOP
+L2551:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2550
+NOP
+L2552:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2553
+NOP
+L2553:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f88_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2556:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2554
+NOP
+SW $t1, 296($fp)
+J L2555
+NOP
+L2554:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2556
+NOP
+L2555:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2557
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2558
+NOP
+L2557:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2559
+NOP
+L2558:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2559:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2560
+NOP
+SW $t1, 248($fp)
+J L2561
+NOP
+L2560:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2559
+NOP
+L2561:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2562
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2563
+NOP
+L2562:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2564
+NOP
+L2563:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2564:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2565
+NOP
+SW $t1, 192($fp)
+J L2566
+NOP
+L2565:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2564
+NOP
+L2566:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2567
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2568
+NOP
+L2567:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2569
+NOP
+L2568:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2569:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2570
+NOP
+SW $t1, 136($fp)
+J L2571
+NOP
+L2570:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2569
+NOP
+L2571:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2572
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2573
+NOP
+L2572:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2574
+NOP
+L2573:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2574:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2575
+NOP
+SW $t1, 80($fp)
+J L2576
+NOP
+L2575:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2574
+NOP
+L2576:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2577
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2578
+NOP
+L2577:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2579
+NOP
+L2578:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2579:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2580
+NOP
+SW $t1, 24($fp)
+J L2581
+NOP
+L2580:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2579
+NOP
+L2581:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2582
+NOP
+L2582:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f89_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2585:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2583
+NOP
+SW $t1, 296($fp)
+J L2584
+NOP
+L2583:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2585
+NOP
+L2584:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2586
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2587
+NOP
+L2586:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2588
+NOP
+L2587:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2588:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2589
+NOP
+SW $t1, 248($fp)
+J L2590
+NOP
+L2589:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2588
+NOP
+L2590:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2591
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2592
+NOP
+L2591:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2593
+NOP
+L2592:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2593:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2594
+NOP
+SW $t1, 192($fp)
+J L2595
+NOP
+L2594:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2593
+NOP
+L2595:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2596
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2597
+NOP
+L2596:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2598
+NOP
+L2597:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2598:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2599
+NOP
+SW $t1, 136($fp)
+J L2600
+NOP
+L2599:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2598
+NOP
+L2600:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2601
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2602
+NOP
+L2601:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2603
+NOP
+L2602:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2603:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2604
+NOP
+SW $t1, 80($fp)
+J L2605
+NOP
+L2604:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2603
+NOP
+L2605:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2606
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2607
+NOP
+L2606:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2608
+NOP
+L2607:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2608:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2609
+NOP
+SW $t1, 24($fp)
+J L2610
+NOP
+L2609:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2608
+NOP
+L2610:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2611
+NOP
+L2611:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f90_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2614:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2612
+NOP
+SW $t1, 296($fp)
+J L2613
+NOP
+L2612:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2614
+NOP
+L2613:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2615
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2616
+NOP
+L2615:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2617
+NOP
+L2616:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2617:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2618
+NOP
+SW $t1, 248($fp)
+J L2619
+NOP
+L2618:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2617
+NOP
+L2619:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2620
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2621
+NOP
+L2620:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2622
+NOP
+L2621:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2622:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2623
+NOP
+SW $t1, 192($fp)
+J L2624
+NOP
+L2623:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2622
+NOP
+L2624:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2625
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2626
+NOP
+L2625:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2627
+NOP
+L2626:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2627:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2628
+NOP
+SW $t1, 136($fp)
+J L2629
+NOP
+L2628:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2627
+NOP
+L2629:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2630
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2631
+NOP
+L2630:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2632
+NOP
+L2631:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2632:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2633
+NOP
+SW $t1, 80($fp)
+J L2634
+NOP
+L2633:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2632
+NOP
+L2634:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2635
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2636
+NOP
+L2635:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2637
+NOP
+L2636:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2637:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2638
+NOP
+SW $t1, 24($fp)
+J L2639
+NOP
+L2638:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2637
+NOP
+L2639:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2640
+NOP
+L2640:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f91_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2643:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2641
+NOP
+SW $t1, 296($fp)
+J L2642
+NOP
+L2641:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2643
+NOP
+L2642:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2644
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2645
+NOP
+L2644:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2646
+NOP
+L2645:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2646:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2647
+NOP
+SW $t1, 248($fp)
+J L2648
+NOP
+L2647:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2646
+NOP
+L2648:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2649
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2650
+NOP
+L2649:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2651
+NOP
+L2650:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2651:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2652
+NOP
+SW $t1, 192($fp)
+J L2653
+NOP
+L2652:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2651
+NOP
+L2653:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2654
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2655
+NOP
+L2654:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2656
+NOP
+L2655:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2656:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2657
+NOP
+SW $t1, 136($fp)
+J L2658
+NOP
+L2657:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2656
+NOP
+L2658:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2659
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2660
+NOP
+L2659:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2661
+NOP
+L2660:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2661:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2662
+NOP
+SW $t1, 80($fp)
+J L2663
+NOP
+L2662:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2661
+NOP
+L2663:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2664
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2665
+NOP
+L2664:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2666
+NOP
+L2665:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2666:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2667
+NOP
+SW $t1, 24($fp)
+J L2668
+NOP
+L2667:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2666
+NOP
+L2668:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2669
+NOP
+L2669:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f92_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2672:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2670
+NOP
+SW $t1, 296($fp)
+J L2671
+NOP
+L2670:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2672
+NOP
+L2671:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2673
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2674
+NOP
+L2673:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2675
+NOP
+L2674:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2675:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2676
+NOP
+SW $t1, 248($fp)
+J L2677
+NOP
+L2676:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2675
+NOP
+L2677:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2678
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2679
+NOP
+L2678:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2680
+NOP
+L2679:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2680:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2681
+NOP
+SW $t1, 192($fp)
+J L2682
+NOP
+L2681:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2680
+NOP
+L2682:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2683
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2684
+NOP
+L2683:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2685
+NOP
+L2684:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2685:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2686
+NOP
+SW $t1, 136($fp)
+J L2687
+NOP
+L2686:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2685
+NOP
+L2687:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2688
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2689
+NOP
+L2688:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2690
+NOP
+L2689:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2690:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2691
+NOP
+SW $t1, 80($fp)
+J L2692
+NOP
+L2691:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2690
+NOP
+L2692:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2693
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2694
+NOP
+L2693:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2695
+NOP
+L2694:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2695:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2696
+NOP
+SW $t1, 24($fp)
+J L2697
+NOP
+L2696:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2695
+NOP
+L2697:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2698
+NOP
+L2698:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f93_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2701:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2699
+NOP
+SW $t1, 296($fp)
+J L2700
+NOP
+L2699:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2701
+NOP
+L2700:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2702
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2703
+NOP
+L2702:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2704
+NOP
+L2703:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2704:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2705
+NOP
+SW $t1, 248($fp)
+J L2706
+NOP
+L2705:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2704
+NOP
+L2706:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2707
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2708
+NOP
+L2707:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2709
+NOP
+L2708:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2709:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2710
+NOP
+SW $t1, 192($fp)
+J L2711
+NOP
+L2710:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2709
+NOP
+L2711:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2712
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2713
+NOP
+L2712:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2714
+NOP
+L2713:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2714:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2715
+NOP
+SW $t1, 136($fp)
+J L2716
+NOP
+L2715:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2714
+NOP
+L2716:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2717
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2718
+NOP
+L2717:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2719
+NOP
+L2718:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2719:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2720
+NOP
+SW $t1, 80($fp)
+J L2721
+NOP
+L2720:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2719
+NOP
+L2721:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2722
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2723
+NOP
+L2722:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2724
+NOP
+L2723:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2724:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2725
+NOP
+SW $t1, 24($fp)
+J L2726
+NOP
+L2725:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2724
+NOP
+L2726:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2727
+NOP
+L2727:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f94_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2730:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2728
+NOP
+SW $t1, 296($fp)
+J L2729
+NOP
+L2728:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2730
+NOP
+L2729:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2731
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2732
+NOP
+L2731:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2733
+NOP
+L2732:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2733:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2734
+NOP
+SW $t1, 248($fp)
+J L2735
+NOP
+L2734:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2733
+NOP
+L2735:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2736
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2737
+NOP
+L2736:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2738
+NOP
+L2737:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2738:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2739
+NOP
+SW $t1, 192($fp)
+J L2740
+NOP
+L2739:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2738
+NOP
+L2740:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2741
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2742
+NOP
+L2741:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2743
+NOP
+L2742:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2743:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2744
+NOP
+SW $t1, 136($fp)
+J L2745
+NOP
+L2744:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2743
+NOP
+L2745:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2746
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2747
+NOP
+L2746:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2748
+NOP
+L2747:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2748:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2749
+NOP
+SW $t1, 80($fp)
+J L2750
+NOP
+L2749:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2748
+NOP
+L2750:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2751
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2752
+NOP
+L2751:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2753
+NOP
+L2752:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2753:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2754
+NOP
+SW $t1, 24($fp)
+J L2755
+NOP
+L2754:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2753
+NOP
+L2755:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2756
+NOP
+L2756:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f95_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2759:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2757
+NOP
+SW $t1, 296($fp)
+J L2758
+NOP
+L2757:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2759
+NOP
+L2758:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2760
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2761
+NOP
+L2760:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2762
+NOP
+L2761:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2762:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2763
+NOP
+SW $t1, 248($fp)
+J L2764
+NOP
+L2763:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2762
+NOP
+L2764:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2765
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2766
+NOP
+L2765:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2767
+NOP
+L2766:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2767:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2768
+NOP
+SW $t1, 192($fp)
+J L2769
+NOP
+L2768:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2767
+NOP
+L2769:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2770
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2771
+NOP
+L2770:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2772
+NOP
+L2771:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2772:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2773
+NOP
+SW $t1, 136($fp)
+J L2774
+NOP
+L2773:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2772
+NOP
+L2774:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2775
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2776
+NOP
+L2775:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2777
+NOP
+L2776:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2777:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2778
+NOP
+SW $t1, 80($fp)
+J L2779
+NOP
+L2778:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2777
+NOP
+L2779:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2780
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2781
+NOP
+L2780:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2782
+NOP
+L2781:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2782:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2783
+NOP
+SW $t1, 24($fp)
+J L2784
+NOP
+L2783:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2782
+NOP
+L2784:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2785
+NOP
+L2785:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f96_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2788:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2786
+NOP
+SW $t1, 296($fp)
+J L2787
+NOP
+L2786:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2788
+NOP
+L2787:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2789
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2790
+NOP
+L2789:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2791
+NOP
+L2790:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2791:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2792
+NOP
+SW $t1, 248($fp)
+J L2793
+NOP
+L2792:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2791
+NOP
+L2793:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2794
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2795
+NOP
+L2794:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2796
+NOP
+L2795:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2796:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2797
+NOP
+SW $t1, 192($fp)
+J L2798
+NOP
+L2797:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2796
+NOP
+L2798:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2799
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2800
+NOP
+L2799:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2801
+NOP
+L2800:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2801:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2802
+NOP
+SW $t1, 136($fp)
+J L2803
+NOP
+L2802:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2801
+NOP
+L2803:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2804
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2805
+NOP
+L2804:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2806
+NOP
+L2805:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2806:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2807
+NOP
+SW $t1, 80($fp)
+J L2808
+NOP
+L2807:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2806
+NOP
+L2808:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2809
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2810
+NOP
+L2809:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2811
+NOP
+L2810:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2811:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2812
+NOP
+SW $t1, 24($fp)
+J L2813
+NOP
+L2812:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2811
+NOP
+L2813:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2814
+NOP
+L2814:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f97_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2817:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2815
+NOP
+SW $t1, 296($fp)
+J L2816
+NOP
+L2815:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2817
+NOP
+L2816:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2818
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2819
+NOP
+L2818:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2820
+NOP
+L2819:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2820:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2821
+NOP
+SW $t1, 248($fp)
+J L2822
+NOP
+L2821:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2820
+NOP
+L2822:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2823
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2824
+NOP
+L2823:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2825
+NOP
+L2824:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2825:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2826
+NOP
+SW $t1, 192($fp)
+J L2827
+NOP
+L2826:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2825
+NOP
+L2827:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2828
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2829
+NOP
+L2828:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2830
+NOP
+L2829:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2830:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2831
+NOP
+SW $t1, 136($fp)
+J L2832
+NOP
+L2831:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2830
+NOP
+L2832:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2833
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2834
+NOP
+L2833:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2835
+NOP
+L2834:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2835:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2836
+NOP
+SW $t1, 80($fp)
+J L2837
+NOP
+L2836:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2835
+NOP
+L2837:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2838
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2839
+NOP
+L2838:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2840
+NOP
+L2839:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2840:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2841
+NOP
+SW $t1, 24($fp)
+J L2842
+NOP
+L2841:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2840
+NOP
+L2842:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2843
+NOP
+L2843:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f98_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2846:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2844
+NOP
+SW $t1, 296($fp)
+J L2845
+NOP
+L2844:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2846
+NOP
+L2845:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2847
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2848
+NOP
+L2847:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2849
+NOP
+L2848:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2849:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2850
+NOP
+SW $t1, 248($fp)
+J L2851
+NOP
+L2850:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2849
+NOP
+L2851:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2852
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2853
+NOP
+L2852:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2854
+NOP
+L2853:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2854:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2855
+NOP
+SW $t1, 192($fp)
+J L2856
+NOP
+L2855:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2854
+NOP
+L2856:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2857
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2858
+NOP
+L2857:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2859
+NOP
+L2858:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2859:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2860
+NOP
+SW $t1, 136($fp)
+J L2861
+NOP
+L2860:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2859
+NOP
+L2861:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2862
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2863
+NOP
+L2862:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2864
+NOP
+L2863:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2864:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2865
+NOP
+SW $t1, 80($fp)
+J L2866
+NOP
+L2865:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2864
+NOP
+L2866:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2867
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2868
+NOP
+L2867:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2869
+NOP
+L2868:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2869:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2870
+NOP
+SW $t1, 24($fp)
+J L2871
+NOP
+L2870:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2869
+NOP
+L2871:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2872
+NOP
+L2872:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_f99_S0__sig_5_5:
+ADDIU $sp, $sp, -336
+SW $ra, 332($sp)
+SW $fp, 328($sp)
+MOVE $fp, $sp
+LW $t0, 340($fp)
+LW $t1, 336($fp)
+ADDU $t2, $t0, $t1
+LA $t3, immediate_0
+LW $t4, 0($t3)
+MUL $t5, $t2, $t4
+LA $t3, immediate_1
+LW $t6, 0($t3)
+SW $t6, 300($fp)
+SW $t6, 304($fp)
+SW $t5, 308($fp)
+SW $t5, 312($fp)
+SW $t4, 316($fp)
+SW $t2, 320($fp)
+SW $t2, 324($fp)
+L2875:
+LA $t0, immediate_2
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+BLT $t2, $t1, L2873
+NOP
+SW $t1, 296($fp)
+J L2874
+NOP
+L2873:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 300($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 300($fp)
+SW $t3, 284($fp)
+SW $t1, 288($fp)
+J L2875
+NOP
+L2874:
+LA $t0, immediate_1
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+MUL $t3, $t2, $t1
+LW $t4, 320($fp)
+ADDU $t5, $t4, $t3
+BGT $t5, $t2, L2876
+NOP
+SW $t5, 320($fp)
+SW $t5, 272($fp)
+SW $t3, 276($fp)
+SW $t2, 308($fp)
+SW $t1, 280($fp)
+J L2877
+NOP
+L2876:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 260($fp)
+SW $t1, 264($fp)
+J L2878
+NOP
+L2877:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 252($fp)
+SW $t1, 256($fp)
+L2878:
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2879
+NOP
+SW $t1, 248($fp)
+J L2880
+NOP
+L2879:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 236($fp)
+SW $t1, 240($fp)
+J L2878
+NOP
+L2880:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_4
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2881
+NOP
+SW $t7, 320($fp)
+SW $t7, 216($fp)
+SW $t6, 220($fp)
+SW $t5, 308($fp)
+SW $t5, 228($fp)
+LA $t3, _v_g0_S0
+SW $t4, 0($t3)
+SW $t2, 232($fp)
+SW $t1, 224($fp)
+J L2882
+NOP
+L2881:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 204($fp)
+SW $t1, 208($fp)
+J L2883
+NOP
+L2882:
+LA $t0, immediate_5
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 196($fp)
+SW $t1, 200($fp)
+L2883:
+LA $t0, immediate_6
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2884
+NOP
+SW $t1, 192($fp)
+J L2885
+NOP
+L2884:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 180($fp)
+SW $t1, 184($fp)
+J L2883
+NOP
+L2885:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_7
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2886
+NOP
+SW $t7, 320($fp)
+SW $t7, 160($fp)
+SW $t6, 164($fp)
+SW $t5, 308($fp)
+SW $t5, 172($fp)
+SW $t2, 176($fp)
+SW $t1, 168($fp)
+J L2887
+NOP
+L2886:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 148($fp)
+SW $t1, 152($fp)
+J L2888
+NOP
+L2887:
+LA $t0, immediate_8
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 140($fp)
+SW $t1, 144($fp)
+L2888:
+LA $t0, immediate_9
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2889
+NOP
+SW $t1, 136($fp)
+J L2890
+NOP
+L2889:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 124($fp)
+SW $t1, 128($fp)
+J L2888
+NOP
+L2890:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_10
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2891
+NOP
+SW $t7, 320($fp)
+SW $t7, 104($fp)
+SW $t6, 108($fp)
+SW $t5, 308($fp)
+SW $t5, 116($fp)
+SW $t2, 120($fp)
+SW $t1, 112($fp)
+J L2892
+NOP
+L2891:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 92($fp)
+SW $t1, 96($fp)
+J L2893
+NOP
+L2892:
+LA $t0, immediate_11
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 84($fp)
+SW $t1, 88($fp)
+L2893:
+LA $t0, immediate_12
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2894
+NOP
+SW $t1, 80($fp)
+J L2895
+NOP
+L2894:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 68($fp)
+SW $t1, 72($fp)
+J L2893
+NOP
+L2895:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+LA $t3, immediate_13
+LW $t1, 0($t3)
+MUL $t6, $t5, $t1
+ADDU $t7, $t0, $t6
+BGT $t7, $t5, L2896
+NOP
+SW $t7, 320($fp)
+SW $t7, 48($fp)
+SW $t6, 52($fp)
+SW $t5, 308($fp)
+SW $t5, 60($fp)
+SW $t2, 64($fp)
+SW $t1, 56($fp)
+J L2897
+NOP
+L2896:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+SUBU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 36($fp)
+SW $t1, 40($fp)
+J L2898
+NOP
+L2897:
+LA $t0, immediate_14
+LW $t1, 0($t0)
+LW $t2, 308($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 308($fp)
+SW $t3, 28($fp)
+SW $t1, 32($fp)
+L2898:
+LA $t0, immediate_15
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+BLT $t2, $t1, L2899
+NOP
+SW $t1, 24($fp)
+J L2900
+NOP
+L2899:
+LA $t0, immediate_3
+LW $t1, 0($t0)
+LW $t2, 320($fp)
+ADDU $t3, $t2, $t1
+SW $t3, 320($fp)
+SW $t3, 12($fp)
+SW $t1, 16($fp)
+J L2898
+NOP
+L2900:
+LW $t0, 320($fp)
+LW $t1, 308($fp)
+SUBU $t2, $t0, $t1
+LA $t3, _v_g0_S0
+LW $t4, 0($t3)
+ADDU $t5, $t2, $t4
+ADDU $t1, $t0, $t5
+MOVE $v0, $t1
+SW $t5, 308($fp)
+SW $t5, 4($fp)
+SW $t2, 8($fp)
+SW $t1, 0($fp)
+SW $t0, 320($fp)
+J L2901
+NOP
+L2901:
+LW $fp, 328($sp)
+LW $ra, 332($sp)
+ADDIU $sp, $sp, 336
+JR $ra
+_f_main_S0__sig:
+ADDIU $sp, $sp, -36
+SW $ra, 32($sp)
+SW $fp, 28($sp)
+MOVE $fp, $sp
+LA $t0, immediate_0
+LW $t1, 0($t0)
+LA $t0, immediate_3
+LW $t2, 0($t0)
+ADDIU $sp, $sp, -4
+SW $t2, 0($sp)
+ADDIU $sp, $sp, -4
+SW $t1, 0($sp)
+SW $t1, 20($fp)
+SW $t2, 24($fp)
+LI $a0, 12
+JAL _f_f0_S0__sig_5_5
+NOP
+ADDIU $sp, $sp, 8
+LW $t1, 20($fp)
+LW $t2, 24($fp)
+MOVE $t0, $v0
+LA $t3, immediate_1
+LW $t4, 0($t3)
+MOVE $v0, $t4
+SW $t0, 4($fp)
+SW $t0, 8($fp)
+SW $t4, 0($fp)
+J L2902
+NOP
+L2902:
+LW $fp, 28($sp)
+LW $ra, 32($sp)
+ADDIU $sp, $sp, 36
+JR $ra
+
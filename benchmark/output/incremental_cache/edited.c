@@ -0,0 +1,9206 @@
+int g0 = 1;
+int f0(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f1(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f2(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f3(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f4(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f5(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f6(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f7(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f8(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f9(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f10(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f11(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f12(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f13(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f14(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f15(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f16(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f17(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f18(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f19(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f20(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f21(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f22(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f23(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f24(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f25(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f26(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f27(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f28(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f29(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f30(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f31(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f32(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f33(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f34(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f35(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f36(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f37(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f38(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f39(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f40(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f41(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f42(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f43(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f44(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f45(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f46(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f47(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f48(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f49(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f50(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f51(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f52(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f53(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f54(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f55(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f56(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f57(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f58(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f59(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f60(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f61(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f62(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f63(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f64(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f65(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f66(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f67(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f68(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f69(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f70(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f71(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f72(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f73(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f74(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f75(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f76(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f77(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f78(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f79(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f80(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f81(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f82(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f83(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f84(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f85(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f86(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f87(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f88(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f89(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f90(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f91(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f92(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f93(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f94(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f95(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f96(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f97(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f98(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f99(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f100(int a, int b)
+{
+    int x = a + b;
+    int y = x * 3;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f101(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f102(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f103(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f104(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f105(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f106(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f107(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f108(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f109(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f110(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f111(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f112(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f113(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f114(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f115(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f116(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f117(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f118(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f119(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f120(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f121(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f122(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f123(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f124(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f125(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f126(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f127(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f128(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f129(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f130(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f131(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f132(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f133(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f134(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f135(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f136(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f137(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f138(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f139(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f140(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f141(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f142(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f143(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f144(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f145(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f146(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f147(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f148(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f149(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f150(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f151(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f152(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f153(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f154(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f155(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f156(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f157(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f158(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f159(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f160(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f161(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f162(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f163(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f164(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f165(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f166(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f167(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f168(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f169(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f170(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f171(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f172(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f173(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f174(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f175(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f176(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f177(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f178(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f179(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f180(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f181(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f182(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f183(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f184(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f185(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f186(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f187(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f188(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f189(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f190(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f191(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f192(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f193(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f194(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f195(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f196(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f197(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f198(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int f199(int a, int b)
+{
+    int x = a + b;
+    int y = x * 2;
+    x = x + (y - (x * (y + 0)));
+    if (x > y) { while (x < 1) { x = x - 1; } }
+    while (x < 2) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 4)));
+    if (x > y) { while (x < 5) { x = x - 5; } }
+    while (x < 6) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 8)));
+    if (x > y) { while (x < 9) { x = x - 9; } }
+    while (x < 10) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 12)));
+    if (x > y) { while (x < 13) { x = x - 13; } }
+    while (x < 14) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 16)));
+    if (x > y) { while (x < 17) { x = x - 17; } }
+    while (x < 18) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 20)));
+    if (x > y) { while (x < 21) { x = x - 21; } }
+    while (x < 22) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 24)));
+    if (x > y) { while (x < 25) { x = x - 25; } }
+    while (x < 26) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 28)));
+    if (x > y) { while (x < 29) { x = x - 29; } }
+    while (x < 30) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 32)));
+    if (x > y) { while (x < 33) { x = x - 33; } }
+    while (x < 34) { x = x + 1; }
+    y = (x - y) + g0;
+    x = x + (y - (x * (y + 36)));
+    if (x > y) { while (x < 37) { x = x - 37; } }
+    while (x < 38) { x = x + 1; }
+    y = (x - y) + g0;
+    return x + y;
+}
+int main()
+{
+    int s = f0(1, 2);
+    return 0;
+}